@@ -67,6 +67,8 @@ INCLUDES
 #include "initialization/FGTrim.h"
 #include "input_output/FGScript.h"
 #include "input_output/FGXMLFileRead.h"
+#include "FGThreadPool.h"
+#include "FGPerfMonitor.h"
 
 using namespace std;
 
@@ -101,6 +103,7 @@ FGFDMExec::FGFDMExec(
 
   modelLoaded = false;
   IsChild = false;
+  IsClone = false;
   holding = false;
   Terminate = false;
   StandAlone = false;
@@ -119,6 +122,22 @@ FGFDMExec::FGFDMExec(
   EnginePath = "engine";
   SystemsPath = "systems";
 
+  LOD = eLODFull;
+  LODRate = 4;
+  LODGroundAGL = 100.0;
+  SavedLazyAuxiliary = 0;
+
+  ChildThreads = 1;
+  ChildPool = 0;
+
+  SleepEnabled = 0;
+  SleepDelay = 2.0;
+  SleepVelocity = 0.01;
+  SleepRate = 0.001;
+  Sleeping = false;
+  QuietTime = 0.0;
+  SleepAGL = 0.0;
+
   try {
     char* num = getenv("JSBSIM_DEBUG");
     if (num) debug_lvl = atoi(num); // set debug level
@@ -145,6 +164,9 @@ FGFDMExec::FGFDMExec(
   FGPropertyNode* instanceRoot = Root->GetNode("/fdm/jsbsim",IdFDM,true);
   instance = new FGPropertyManager(instanceRoot);
 
+  Perf = new FGPerfMonitor(instance);
+  PerfFrame = Perf->GetEntry("frame", "");
+
   try {
     char* num = getenv("JSBSIM_DISPERSE");
     if (num) {
@@ -166,7 +188,13 @@ FGFDMExec::FGFDMExec(
 
   trim_status = false;
   ta_mode     = 99;
+  change_driven = 0;
+  script_scheduling = 1;
   trim_completed = 0;
+  trim_solver = tAxisByAxis;
+  trim_iterations = 0;
+  trim_runs = 0;
+  trim_residual = 0.0;
 
   Constructing = true;
   typedef int (FGFDMExec::*iPMF)(void) const;
@@ -180,6 +208,21 @@ FGFDMExec::FGFDMExec(
   instance->Tie("simulation/jsbsim-debug", this, &FGFDMExec::GetDebugLevel, &FGFDMExec::SetDebugLevel);
   instance->Tie("simulation/frame", (int *)&Frame, false);
   instance->Tie("simulation/trim-completed", (int *)&trim_completed, false);
+  instance->Tie("simulation/trim-solver", (int *)&trim_solver, false);
+  instance->Tie("simulation/trim-iterations", this, &FGFDMExec::GetTrimIterations);
+  instance->Tie("simulation/trim-runs", this, &FGFDMExec::GetTrimRuns);
+  instance->Tie("simulation/trim-residual", this, &FGFDMExec::GetTrimResidual);
+  instance->Tie("simulation/change-driven", &change_driven);
+  instance->Tie("simulation/script-scheduling", &script_scheduling);
+  instance->Tie("simulation/lod", this, &FGFDMExec::GetLOD, &FGFDMExec::SetLOD);
+  instance->Tie("simulation/lod-rate", this, &FGFDMExec::GetLODRate, &FGFDMExec::SetLODRate);
+  instance->Tie("simulation/lod-ground-agl-ft", &LODGroundAGL);
+  instance->Tie("simulation/child-threads", this, &FGFDMExec::GetChildThreads, &FGFDMExec::SetChildThreads);
+  instance->Tie("simulation/sleep-enabled", &SleepEnabled);
+  instance->Tie("simulation/sleep-delay-sec", &SleepDelay);
+  instance->Tie("simulation/sleep-velocity-fps", &SleepVelocity);
+  instance->Tie("simulation/sleep-rate-rps", &SleepRate);
+  instance->Tie("simulation/sleeping", this, &FGFDMExec::GetSleeping);
   instance->Tie("forces/hold-down", this, &FGFDMExec::GetHoldDown, &FGFDMExec::SetHoldDown);
 
   Constructing = false;
@@ -210,9 +253,14 @@ FGFDMExec::~FGFDMExec()
     cout << "Caught error: " << msg << endl;
   }
 
+  delete ChildPool;
+
   for (unsigned int i=1; i<ChildFDMList.size(); i++) delete ChildFDMList[i]->exec;
   ChildFDMList.clear();
 
+  if (Perf->GetReportAtExit()) Perf->Report(cout);
+  delete Perf;
+
   PropertyCatalog.clear();
   
   //SetGroundCallback(0);
@@ -273,6 +321,10 @@ bool FGFDMExec::Allocate(void)
   Accelerations = (FGAccelerations*)Models[eAccelerations];
   Output = (FGOutput*)Models[eOutput];
 
+  PerfModels.resize(Models.size());
+  for (unsigned int i = 0; i < Models.size(); i++)
+    PerfModels[i] = Perf->GetEntry("models", Models[i]->Name);
+
   // Initialize planet (environment) constants
   LoadPlanetConstants();
   //GetGroundCallback()->SetSeaLevelRadius(Inertial->GetRefRadius());
@@ -318,24 +370,31 @@ bool FGFDMExec::DeAllocate(void)
 bool FGFDMExec::Run(void)
 {
   bool success=true;
+  FGPerfMonitor::Scope frameTimer(Perf, PerfFrame);
 
   Debug(2);
 
-  for (unsigned int i=1; i<ChildFDMList.size(); i++) {
-    ChildFDMList[i]->AssignState( (FGPropagate*)Models[ePropagate] ); // Transfer state to the child FDM
-    ChildFDMList[i]->Run();
+  if (Sleeping) {
+    if (!WakeUpRequested()) return RunAsleep();
+    Wake();
   }
 
+  RunChildren();
+
   IncrTime();
 
   // returns true if success, false if complete
   if (Script != 0 && !IntegrationSuspended()) success = Script->RunScript();
 
   for (unsigned int i = 0; i < Models.size(); i++) {
+    if (LOD != eLODFull && SkipModel(i)) continue;
     LoadInputs(i);
+    FGPerfMonitor::Scope timer(Perf, PerfModels[i]);
     Models[i]->Run(holding);
   }
 
+  if (SleepEnabled) UpdateSleep();
+
   if (ResetMode) {
     unsigned int mode = ResetMode;
 
@@ -350,6 +409,260 @@ bool FGFDMExec::Run(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFDMExec::RunChildren(void)
+{
+  unsigned int nChildren = ChildFDMList.size() > 1 ? ChildFDMList.size()-1 : 0;
+
+  if (ChildThreads == 1 || nChildren < 2) {
+    for (unsigned int i=1; i<ChildFDMList.size(); i++) {
+      ChildFDMList[i]->AssignState( (FGPropagate*)Models[ePropagate] ); // Transfer state to the child FDM
+      ChildFDMList[i]->Run();
+    }
+    return;
+  }
+
+  if (!ChildPool) ChildPool = new FGThreadPool(ChildThreads);
+
+  // Each child only reads the state of its parent and writes its own models.
+  class ChildTask : public FGThreadPool::Task
+  {
+  public:
+    ChildTask(const vector<childData*>& children, FGPropagate* parent)
+      : Children(children), Parent(parent) {}
+    void Execute(unsigned int index, unsigned int) {
+      Children[index+1]->AssignState(Parent);
+      Children[index+1]->Run();
+    }
+  private:
+    const vector<childData*>& Children;
+    FGPropagate* Parent;
+  } task(ChildFDMList, Propagate);
+
+  ChildPool->Run(task, nChildren);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SetChildThreads(int n)
+{
+  if (n < 0) n = 1;
+  if (n == ChildThreads) return;
+
+  ChildThreads = n;
+  delete ChildPool;
+  ChildPool = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Frame of a sleeping instance: the state is frozen but the time goes on, the
+// script can trigger its events and the input/output sockets are serviced.
+
+bool FGFDMExec::RunAsleep(void)
+{
+  bool success=true;
+
+  IncrTime();
+
+  if (Script != 0 && !IntegrationSuspended()) success = Script->RunScript();
+
+  LoadInputs(eInput);
+  Models[eInput]->Run(holding);
+  LoadInputs(eOutput);
+  Models[eOutput]->Run(holding);
+
+  if (Terminate) success = false;
+
+  return success;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::UpdateSleep(void)
+{
+  GetPilotInputs(CurrentInputs);
+  bool quiet = !PilotInputsChanged() && IsParked();
+  SleepInputs.swap(CurrentInputs);
+
+  if (!quiet || holding || IntegrationSuspended() || trim_status) {
+    QuietTime = 0.0;
+    return;
+  }
+
+  QuietTime += dT;
+  if (QuietTime < SleepDelay) return;
+
+  // Snapshot of the inputs that can wake the instance up. Only the branches
+  // written by the pilot, the autopilot and the application are watched so
+  // that a sleeping instance does not scan the whole property tree each frame.
+  static const char* WakeBranches[] = {"fcs", "ap", "propulsion",
+                                       "external_reactions", "gear", "inertia",
+                                       "ic"};
+  SleepVersions.clear();
+  for (unsigned int i=0; i<sizeof(WakeBranches)/sizeof(WakeBranches[0]); i++) {
+    const SGPropertyNode* branch = instance->GetNode()->getNode(WakeBranches[i]);
+    if (branch) CollectVersions(branch);
+  }
+  SleepAGL = Propagate->GetDistanceAGL();
+  Sleeping = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::CollectVersions(const SGPropertyNode* node)
+{
+  if (node->nChildren() == 0)
+    SleepVersions.push_back(make_pair(node, node->getVersion()));
+
+  for (int i=0; i<node->nChildren(); i++)
+    CollectVersions(node->getChild(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFDMExec::IsParked(void) const
+{
+  if (Propagate->GetUVW().Magnitude() > SleepVelocity
+      || Propagate->GetPQR().Magnitude() > SleepRate
+      || Propagate->GetTerrainVelocity().Magnitude() != 0.0
+      || Propagate->GetTerrainAngularVelocity().Magnitude() != 0.0)
+    return false;
+
+  unsigned int nBogeys = 0;
+  for (int i=0; i<GroundReactions->GetNumGearUnits(); i++) {
+    FGLGear* gear = GroundReactions->GetGearUnit(i);
+    if (!gear->IsBogey()) continue;
+    if (!gear->GetWOW()) return false;
+    nBogeys++;
+  }
+  if (nBogeys == 0) return false;
+
+  for (unsigned int i=0; i<Propulsion->GetNumEngines(); i++)
+    if (Propulsion->GetEngine(i)->GetRunning()) return false;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGFDMExec::WakeUpRequested(void)
+{
+  if (!SleepEnabled) return true;
+
+  for (unsigned int i=0; i<SleepVersions.size(); i++) {
+    if (SleepVersions[i].first->getVersion() != SleepVersions[i].second)
+      return true;
+  }
+
+  GetPilotInputs(CurrentInputs);
+  if (PilotInputsChanged()) return true;
+
+  if (Propagate->GetDistanceAGL() != SleepAGL) return true;
+
+  Propagate->RecomputeLocalTerrainVelocity();
+  return Propagate->GetTerrainVelocity().Magnitude() != 0.0
+      || Propagate->GetTerrainAngularVelocity().Magnitude() != 0.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::GetPilotInputs(vector<double>& inputs) const
+{
+  inputs.clear();
+  inputs.push_back(FCS->GetDaCmd());
+  inputs.push_back(FCS->GetDeCmd());
+  inputs.push_back(FCS->GetDrCmd());
+  inputs.push_back(FCS->GetDsCmd());
+  inputs.push_back(FCS->GetDfCmd());
+  inputs.push_back(FCS->GetDsbCmd());
+  inputs.push_back(FCS->GetDspCmd());
+  inputs.push_back(FCS->GetPitchTrimCmd());
+  inputs.push_back(FCS->GetYawTrimCmd());
+  inputs.push_back(FCS->GetRollTrimCmd());
+  inputs.push_back(FCS->GetGearCmd());
+
+  const vector<double>& throttle = FCS->GetThrottleCmd();
+  inputs.insert(inputs.end(), throttle.begin(), throttle.end());
+  const vector<double>& mixture = FCS->GetMixtureCmd();
+  inputs.insert(inputs.end(), mixture.begin(), mixture.end());
+  const vector<double>& brakes = FCS->GetBrakePos();
+  inputs.insert(inputs.end(), brakes.begin(), brakes.end());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Some "commands" are computed by the systems of the aircraft (the mixture of
+// the c172x for instance) and jitter in their last digits.
+
+bool FGFDMExec::PilotInputsChanged(void) const
+{
+  if (CurrentInputs.size() != SleepInputs.size()) return true;
+
+  for (unsigned int i=0; i<CurrentInputs.size(); i++)
+    if (fabs(CurrentInputs[i] - SleepInputs[i]) > 1E-6) return true;
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SetLOD(int lod)
+{
+  if (lod < eLODFull) lod = eLODFull;
+  if (lod > eLODMinimal) lod = eLODMinimal;
+
+  // The lazy evaluation of FGAuxiliary requested by the user is restored when
+  // the full level of detail is selected again.
+  if (LOD == eLODFull && lod != eLODFull)
+    SavedLazyAuxiliary = Auxiliary->GetLazyDerived();
+
+  LOD = lod;
+  ApplyLOD();
+
+  for (unsigned int i=1; i<ChildFDMList.size(); i++)
+    ChildFDMList[i]->exec->SetLOD(lod);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SetLODRate(int rate)
+{
+  LODRate = rate < 1 ? 1 : rate;
+  ApplyLOD();
+
+  for (unsigned int i=1; i<ChildFDMList.size(); i++)
+    ChildFDMList[i]->exec->SetLODRate(rate);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The decimated models keep their forces and moments between two executions
+// and integrate their internal states over the time elapsed since their last
+// execution (in.TotalDeltaT): the engines burn their fuel and the gas cells
+// exchange heat and gas over the whole period. Changing their rate therefore
+// does not disturb them.
+
+void FGFDMExec::ApplyLOD(void)
+{
+  BuoyantForces->SetRate(LOD >= eLODReduced ? LODRate : 1);
+  Propulsion->SetRate(LOD >= eLODMinimal ? LODRate : 1);
+  Propulsion->in.PerformanceMode = LOD >= eLODMinimal;
+  Auxiliary->SetLazyDerived(LOD != eLODFull ? 1 : SavedLazyAuxiliary);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// At the reduced levels of detail, the ground reactions are skipped as long as
+// they produce no force (no gear or contact point touches the ground) and the
+// aircraft is high enough for none of them to touch the ground within a frame.
+
+bool FGFDMExec::SkipModel(unsigned int idx) const
+{
+  if (idx != eGroundReactions) return false;
+
+  return GroundReactions->GetForces().Magnitude() == 0.0
+      && GroundReactions->GetMoments().Magnitude() == 0.0
+      && Propagate->GetDistanceAGL() > LODGroundAGL;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::LoadInputs(unsigned int idx)
 {
   switch(idx) {
@@ -373,6 +686,9 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     Winds->in.Tl2b             = Propagate->GetTl2b();
     Winds->in.Tw2b             = Auxiliary->GetTw2b();
     Winds->in.V                = Auxiliary->GetVt();
+    Winds->in.latitude         = Propagate->GetGeodLatitudeRad();
+    Winds->in.longitude        = Propagate->GetLongitude();
+    Winds->in.vVel             = Propagate->GetVel();
     Winds->in.totalDeltaT      = dT * Winds->GetRate();
     break;
   case eAuxiliary:
@@ -405,7 +721,7 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     Auxiliary->in.SinPhi       = Propagate->GetSinEuler(ePhi);
     Auxiliary->in.Psi          = Propagate->GetEuler(ePsi);
     Auxiliary->in.TotalWindNED = Winds->GetTotalWindNED();
-    Auxiliary->in.TurbPQR      = Winds->GetTurbPQR();
+    Auxiliary->in.TurbPQR      = Winds->GetTurbPQR() + Winds->GetWindFieldPQR();
     Auxiliary->in.WindPsi      = Winds->GetWindPsi();
     Auxiliary->in.Vwind        = Winds->GetTotalWindNED().Magnitude();
     break;
@@ -477,6 +793,7 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     BuoyantForces->in.Pressure    = Atmosphere->GetPressure();
     BuoyantForces->in.Temperature = Atmosphere->GetTemperature();
     BuoyantForces->in.gravity     = Inertial->gravity();
+    BuoyantForces->in.TotalDeltaT = dT * BuoyantForces->GetRate();
     break;
   case eMassBalance:
     MassBalance->in.GasInertia  = BuoyantForces->GetGasMassInertia();
@@ -542,6 +859,8 @@ void FGFDMExec::LoadPlanetConstants(void)
 void FGFDMExec::LoadModelConstants(void)
 {
   Winds->in.wingspan             = Aircraft->GetWingSpan();
+  Winds->in.HTailArm             = Aircraft->GetHTailArm();
+  Winds->in.planetRadius         = Inertial->GetRefRadius();
   Aerodynamics->in.Wingarea      = Aircraft->GetWingArea();
   Aerodynamics->in.Wingchord     = Aircraft->Getcbar();
   Aerodynamics->in.Wingincidence = Aircraft->GetWingIncidence();
@@ -598,6 +917,7 @@ bool FGFDMExec::RunIC(void)
 
 void FGFDMExec::Initialize(FGInitialCondition* FGIC)
 {
+  Wake();
   Propagate->SetInitialState(FGIC);
   Winds->SetWindNED(FGIC->GetWindNEDFpsIC());
   Run();
@@ -704,8 +1024,12 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
   if (modelLoaded) {
     DeAllocate();
     Allocate();
+    ApplyLOD();
   }
 
+  // The dispersed values only depend on the seed of this instance.
+  SeedDispersions(RandomSeed);
+
   int saved_debug_lvl = debug_lvl;
   FGXMLFileRead XMLFileRead;
   Element *document = XMLFileRead.LoadXMLDocument(aircraftCfgFileName); // "document" is a class member
@@ -855,8 +1179,8 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
     }
 
     // Process the output element[s]. This element is OPTIONAL, and there may be
-    // more than one.
-    element = document->FindElement("output");
+    // more than one. Clones never write any output.
+    element = IsClone ? 0 : document->FindElement("output");
     while (element) {
       if (!static_cast<FGOutput*>(Models[eOutput])->Load(element))
         return false;
@@ -866,12 +1190,13 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
     // Lastly, process the child element. This element is OPTIONAL - and NOT YET SUPPORTED.
     element = document->FindElement("child");
-    if (element) {
+    while (element) {
       result = ReadChild(element);
       if (!result) {
         cerr << endl << "Aircraft child element has problems in file " << aircraftCfgFileName << endl;
         return result;
       }
+      element = document->FindNextElement("child");
     }
 
     // Since all vehicle characteristics have been loaded, place the values in the Inputs
@@ -902,6 +1227,109 @@ bool FGFDMExec::LoadModel(const string& model, bool addModelToPath)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGFDMExec* FGFDMExec::Clone(void)
+{
+  if (!modelLoaded) return 0;
+
+  FGFDMExec* clone = new FGFDMExec(GetGroundCallback());
+
+  clone->IsClone = true;
+  clone->RootDir = RootDir;
+  clone->AircraftPath = FullAircraftPath;
+  clone->EnginePath = EnginePath;
+  clone->SystemsPath = SystemsPath;
+  bool result = clone->LoadModel(modelName, false);
+  clone->AircraftPath = AircraftPath;
+
+  if (!result) {
+    delete clone;
+    return 0;
+  }
+
+  clone->DisableOutput();
+  clone->CopyStateFrom(this);
+
+  return clone;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::CopyStateFrom(FGFDMExec* source)
+{
+  dT = source->dT;
+  saved_dT = source->saved_dT;
+  *IC = *(source->IC);
+  CopyPropertyValues(source->instance->GetNode(), instance->GetNode(), true);
+  GetWinds()->ShareWindField(source->GetWinds());
+  Random = source->Random;
+  change_driven = source->change_driven;
+  script_scheduling = source->script_scheduling;
+  LODRate = source->LODRate;
+  LODGroundAGL = source->LODGroundAGL;
+  SetLOD(source->LOD);
+  SetChildThreads(source->ChildThreads);
+  SleepEnabled = source->SleepEnabled;
+  SleepDelay = source->SleepDelay;
+  SleepVelocity = source->SleepVelocity;
+  SleepRate = source->SleepRate;
+
+  Setsim_time(source->sim_time);
+  Propagate->SetVState(source->Propagate->GetVState());
+  Propagate->SetInertialVelocity(source->Propagate->GetInertialVelocity());
+  SuspendIntegration();
+  Run();
+  Propagate->InitializeDerivatives();
+  ResumeIntegration();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::CopyPropertyValues(FGPropertyNode* from, FGPropertyNode* to,
+                                   bool topLevel)
+{
+  for (int i=0; i<from->nChildren(); i++) {
+    FGPropertyNode* source = (FGPropertyNode*)from->getChild(i);
+    string name = source->getName();
+
+    if (topLevel && (name == "simulation" || name == "ic")) continue;
+
+    FGPropertyNode* target = (FGPropertyNode*)to->getChild(name, source->getIndex());
+    if (!target) continue;
+
+    if (source->nChildren() > 0) {
+      CopyPropertyValues(source, target, false);
+      continue;
+    }
+
+    if (!source->getAttribute(SGPropertyNode::READ) ||
+        !source->getAttribute(SGPropertyNode::WRITE) ||
+        !target->getAttribute(SGPropertyNode::WRITE))
+      continue;
+
+    // Only write the values that differ to avoid triggering setters needlessly
+    switch (source->getType()) {
+    case simgear::props::BOOL:
+      if (target->getBoolValue() != source->getBoolValue())
+        target->setBoolValue(source->getBoolValue());
+      break;
+    case simgear::props::INT:
+    case simgear::props::LONG:
+      if (target->getIntValue() != source->getIntValue())
+        target->setIntValue(source->getIntValue());
+      break;
+    case simgear::props::FLOAT:
+    case simgear::props::DOUBLE:
+      if (target->getDoubleValue() != source->getDoubleValue())
+        target->setDoubleValue(source->getDoubleValue());
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGFDMExec::GetPropulsionTankReport()
 {
   return ((FGPropulsion*)Models[ePropulsion])->GetPropulsionTankReport();
@@ -1081,6 +1509,9 @@ bool FGFDMExec::ReadChild(Element* el)
   child->exec->SetEnginePath( EnginePath );
   child->exec->SetSystemsPath( SystemsPath );
   child->exec->LoadModel(childAircraft);
+  child->exec->LODGroundAGL = LODGroundAGL;
+  child->exec->SetLODRate(LODRate);
+  child->exec->SetLOD(LOD);
 
   Element* location = el->FindElement("location");
   if (location) {
@@ -1148,13 +1579,23 @@ void FGFDMExec::DoTrim(int mode)
 {
   if (Constructing) return;
 
+  Wake();
+
   if (mode < 0 || mode > JSBSim::tNone)
     throw("Illegal trimming mode!");
 
+  if (trim_solver < tAxisByAxis || trim_solver > tSimultaneous)
+    throw("Illegal trim solver!");
+
   FGTrim trim(this, (JSBSim::TrimMode)mode);
+  trim.SetSolver((JSBSim::TrimSolver)trim_solver);
   bool success = trim.DoTrim();
   trim.Report();
 
+  trim_iterations = trim.GetIterations();
+  trim_runs = trim.GetRunCount();
+  trim_residual = trim.GetResidual();
+
   if (!success)
     throw("Trim Failed");
 
@@ -1166,8 +1607,7 @@ void FGFDMExec::DoTrim(int mode)
 void FGFDMExec::SRand(int sr)
 {
   RandomSeed = sr;
-  gaussian_random_number_phase = 0;
-  srand(RandomSeed);
+  Random.Seed(RandomSeed);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -43,12 +43,15 @@ INCLUDES
 
 #include <vector>
 #include <string>
+#include <utility>
 
 #include "FGJSBBase.h"
 #include "input_output/FGPropertyManager.h"
 #include "models/FGPropagate.h"
 #include "math/FGColumnVector3.h"
+#include "math/FGRandom.h"
 #include "models/FGOutput.h"
+#include "FGPerfMonitor.h"
 #include "simgear/misc/sg_path.hxx"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -64,6 +67,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGScript;
+class FGThreadPool;
 class FGTrim;
 class FGAerodynamics;
 class FGAircraft;
@@ -177,6 +181,90 @@ CLASS DOCUMENTATION
                                 tCustom (4), tTurn (5). Setting this to a legal value
                                 (such as by a script) causes a trim to be performed. This
                                 property actually maps toa function call of DoTrim().
+    @property simulation/trim-solver Selects the trim algorithm used by
+                                simulation/do_simple_trim: tAxisByAxis (0, default)
+                                or tSimultaneous (1). See FGTrim.
+    @property simulation/trim-iterations (read only) Iterations of the last trim.
+    @property simulation/trim-runs (read only) FDM runs of the last trim.
+    @property simulation/trim-residual (read only) Largest state to tolerance
+                                ratio at the end of the last trim (<= 1 when trimmed).
+    @property simulation/randomseed Seed of the random number generator of this
+                                instance (turbulence, sensor noise, random functions).
+                                Setting it restarts the random sequence. It also
+                                seeds the dispersions of the values read by the
+                                next LoadModel().
+    @property simulation/change-driven When non zero, the stateless FCS
+                                components (gains, summers, switches, deadbands
+                                and FCS functions) and the functions are only
+                                evaluated when one of the properties they read
+                                has changed since their last evaluation.
+    @property simulation/script-scheduling When non zero (the default), the
+                                events of the script are scheduled (see
+                                FGScript). When zero, the condition of every
+                                event is evaluated at every frame.
+    @property simulation/lod Level of detail of the instance, see SetLOD().
+    @property simulation/lod-rate Decimation factor (in frames) of the models
+                                run at a reduced rate by the reduced levels of
+                                detail (default 4).
+    @property simulation/lod-ground-agl-ft Height above the ground above which
+                                the ground reactions are not computed at the
+                                reduced levels of detail (default 100 ft).
+    @property simulation/child-threads Number of threads executing the child
+                                FDMs (1 - the default - for serial execution,
+                                0 for the number of hardware threads).
+    @property simulation/sleep-enabled When non zero, the instance is put to
+                                sleep when it is parked (see below).
+    @property simulation/sleep-delay-sec Time during which the aircraft must
+                                stay parked before it is put to sleep
+                                (default 2 s).
+    @property simulation/sleep-velocity-fps Velocity below which the aircraft
+                                is considered at rest (default 0.01 ft/s).
+    @property simulation/sleep-rate-rps Angular rate below which the aircraft
+                                is considered at rest (default 0.001 rad/s).
+    @property simulation/sleeping (read only) 1 while the instance is asleep.
+    @property simulation/perf/enabled When non zero, the execution times of
+                                the models and of their parts are recorded
+                                under simulation/perf/ (see FGPerfMonitor).
+
+    <h3>Level of detail</h3>
+
+    Instances simulating distant or non-interactive traffic can be switched to
+    a reduced level of detail with SetLOD() (or the property simulation/lod):
+    - eLODFull (0): every model is run every frame (the default),
+    - eLODReduced (1): the ground reactions are skipped while the aircraft
+      flies higher than simulation/lod-ground-agl-ft with no ground contact,
+      the buoyant forces are updated every simulation/lod-rate frames, the
+      FCS channels marked essential="false" are not executed and the rarely
+      read quantities of FGAuxiliary are computed on demand,
+    - eLODMinimal (2): in addition, the propulsion is updated every
+      simulation/lod-rate frames (the engine forces are held in between and
+      the fuel burn is integrated over the whole period) and the engines are
+      run in performance mode (see FGEngine).
+    The state of the instance is not modified by a change of the level of
+    detail which can therefore be switched at any time, in either direction,
+    without trimming the aircraft again. Trimming should be done at eLODFull.
+
+    <h3>Sleeping</h3>
+
+    When simulation/sleep-enabled is set, an aircraft which stays parked for
+    simulation/sleep-delay-sec is put to sleep. It is parked when all its
+    gears are on the ground, its velocity and angular rates are below
+    simulation/sleep-velocity-fps and simulation/sleep-rate-rps, none of its
+    engines is running, the terrain below it does not move and the pilot
+    commands of FGFCS do not change.
+
+    While asleep, Run() only increments the time, runs the script and the
+    input and output models: the state is not integrated. The instance wakes
+    up, and resumes from its state when it fell asleep, at the start of the
+    first frame following:
+    - a write to a property of the fcs/, ap/, propulsion/,
+      external_reactions/, gear/, inertia/ or ic/ branches (controls,
+      external forces, script actions, input sockets, ...),
+    - a change of a pilot command of FGFCS made through its C++ setters,
+    - a change of the terrain elevation or velocity below the aircraft,
+    - a call to Wake(), RunIC(), ResetToInitialConditions() or DoTrim().
+    Applications modifying the state through the C++ interface of the models
+    (FGPropagate::SetVState(), ...) must call Wake().
 
     @author Jon S. Berndt
     @version $Revision: 1.106 $
@@ -234,6 +322,9 @@ public:
   // 2. MassBalance must be executed before Propulsion, Aerodynamics,
   //    GroundReactions, ExternalReactions and BuoyantForces to ensure that
   //    their moments are computed with the updated CG position.
+  /// Levels of detail, see SetLOD().
+  enum eLOD {eLODFull=0, eLODReduced, eLODMinimal};
+
   enum eModels { ePropagate=0,
                  eInput,
                  eInertial,
@@ -426,6 +517,45 @@ public:
   /// Marks this instance of the Exec object as a "child" object.
   void SetChild(bool ch) {IsChild = ch;}
 
+  /** Sets the number of threads executing the child FDMs. The child FDMs are
+      independent within a frame once they have received the state of their
+      parent, so they can be run concurrently. They are all completed before
+      the models of the parent are run, and the results do not depend on the
+      number of threads. The ground callback must be thread safe.
+      @param n number of threads (1 for serial execution, 0 for the number of
+               hardware threads) */
+  void SetChildThreads(int n);
+  int GetChildThreads(void) const { return ChildThreads; }
+
+  /// Returns the timing instrumentation of this instance.
+  FGPerfMonitor* GetPerfMonitor(void) const { return Perf; }
+
+  /** Creates an independent copy of this instance.
+      The same aircraft model is loaded in a new standalone executive with its
+      own property tree. The initial conditions, the values of the writable
+      properties (except those under simulation/ and ic/), the time step and
+      the current state vector are then copied to the clone (see
+      CopyStateFrom()). The output directives of the model are not loaded by
+      the clone, its outputs stay disabled (EnableOutput() has no effect on
+      it) and scripts are not copied.
+      The clone is loaded with the current debug level.
+
+      Clones can be run concurrently with each other (for instance on an
+      FGThreadPool) as long as the ground callback is thread safe.
+      @return a pointer to the clone that must be deleted by the caller, or 0
+              if no model is loaded or the model could not be loaded again. */
+  FGFDMExec* Clone(void);
+
+  /** Copies the state of another instance of the same model into this one.
+      The initial conditions, the values of the writable properties (except
+      those under simulation/ and ic/), the time step, the simulation settings,
+      the wind field (see FGWinds::ShareWindField()) and the state vector are
+      copied, then the models are run once with the
+      integration suspended. Clone() calls it on the new instance; it can be
+      called again to bring a clone back to the state of its source.
+      @param source an instance with the same aircraft model loaded */
+  void CopyStateFrom(FGFDMExec* source);
+
   /** Sets the output (logging) mechanism for this run.
       Calling this function passes the name of an output directives file to
       the FGOutput object associated with this run. The call to this function
@@ -475,8 +605,8 @@ public:
 
   /// Disables data logging to all outputs.
   void DisableOutput(void) { Output->Disable(); }
-  /// Enables data logging to all outputs.
-  void EnableOutput(void) { Output->Enable(); }
+  /// Enables data logging to all outputs. Has no effect on a clone.
+  void EnableOutput(void) { if (!IsClone) Output->Enable(); }
   /// Pauses execution by preventing time from incrementing.
   void Hold(void) {holding = true;}
   /// Turn on hold after increment
@@ -528,7 +658,37 @@ public:
   void SetTrimStatus(bool status){ trim_status = status; }
   bool GetTrimStatus(void) const { return trim_status; }
   void SetTrimMode(int mode){ ta_mode = mode; }
+
+  /** Returns true if the change driven evaluation is enabled. See the property
+      simulation/change-driven. */
+  bool GetChangeDriven(void) const { return change_driven != 0; }
+  void SetChangeDriven(bool enable) { change_driven = enable ? 1 : 0; }
+
+  /** Returns true if the events of the script are scheduled. See the property
+      simulation/script-scheduling. */
+  bool GetScriptScheduling(void) const { return script_scheduling != 0; }
+
+  /** Sets the level of detail of this instance and of its child FDMs. See
+      the section "Level of detail" above.
+      @param lod one of eLODFull, eLODReduced or eLODMinimal */
+  void SetLOD(int lod);
+  /// Returns the level of detail.
+  int GetLOD(void) const { return LOD; }
+  /// Sets the decimation factor of the reduced levels of detail.
+  void SetLODRate(int rate);
+  int GetLODRate(void) const { return LODRate; }
+
+  /// Returns true while the instance is asleep (see simulation/sleep-enabled).
+  bool IsSleeping(void) const { return Sleeping; }
+  /// Wakes the instance up if it is asleep and restarts the sleep delay.
+  void Wake(void) { Sleeping = false; QuietTime = 0.0; }
   int GetTrimMode(void) const { return ta_mode; }
+  /// Returns the number of iterations of the last trim.
+  int GetTrimIterations(void) const { return trim_iterations; }
+  /// Returns the number of FDM runs of the last trim.
+  int GetTrimRuns(void) const { return trim_runs; }
+  /// Returns the largest state to tolerance ratio at the end of the last trim.
+  double GetTrimResidual(void) const { return trim_residual; }
 
   std::string GetPropulsionTankReport();
 
@@ -538,6 +698,10 @@ public:
   /// Returns the simulation delta T.
   double GetDeltaT(void) const {return dT;}
 
+  /** Returns the random number generator of this instance. It is seeded by
+      the property simulation/randomseed. */
+  FGRandom& GetRandom(void) {return Random;}
+
   /// Suspends the simulation and sets the delta T to zero.
   void SuspendIntegration(void) {saved_dT = dT; dT = 0.0;}
 
@@ -617,9 +781,11 @@ private:
   bool IncrementThenHolding;
   int TimeStepsUntilHold;
   int RandomSeed;
+  FGRandom Random;
   bool Constructing;
   bool modelLoaded;
   bool IsChild;
+  bool IsClone;
   std::string modelName;
   SGPath AircraftPath;
   SGPath FullAircraftPath;
@@ -648,8 +814,29 @@ private:
 
   bool trim_status;
   int ta_mode;
+  int change_driven;
+  int script_scheduling;
+  int LOD;
+  int LODRate;
+  double LODGroundAGL;
+  int SavedLazyAuxiliary;
+
+  int SleepEnabled;
+  double SleepDelay;
+  double SleepVelocity;
+  double SleepRate;
+  bool Sleeping;
+  double QuietTime;
+  double SleepAGL;
+  std::vector<double> SleepInputs;
+  std::vector<double> CurrentInputs;
+  std::vector<std::pair<const SGPropertyNode*, unsigned int> > SleepVersions;
   unsigned int ResetMode;
   int trim_completed;
+  int trim_solver;
+  int trim_iterations;
+  int trim_runs;
+  double trim_residual;
 
   FGScript*           Script;
   FGInitialCondition* IC;
@@ -666,14 +853,32 @@ private:
 
   std::vector <std::string> PropertyCatalog;
   std::vector <childData*> ChildFDMList;
+  int ChildThreads;
+  FGThreadPool* ChildPool;
   std::vector <FGModel*> Models;
 
+  FGPerfMonitor* Perf;
+  FGPerfMonitor::Entry* PerfFrame;
+  std::vector <FGPerfMonitor::Entry*> PerfModels;
+
+  void CopyPropertyValues(FGPropertyNode* from, FGPropertyNode* to, bool topLevel);
   bool ReadFileHeader(Element*);
   bool ReadChild(Element*);
   bool ReadPrologue(Element*);
   void SRand(int sr);
   int  SRand(void) const {return RandomSeed;}
   void LoadInputs(unsigned int idx);
+  void RunChildren(void);
+  void ApplyLOD(void);
+  bool SkipModel(unsigned int idx) const;
+  bool RunAsleep(void);
+  void UpdateSleep(void);
+  bool IsParked(void) const;
+  bool WakeUpRequested(void);
+  void GetPilotInputs(std::vector<double>& inputs) const;
+  bool PilotInputsChanged(void) const;
+  void CollectVersions(const SGPropertyNode* node);
+  int GetSleeping(void) const { return Sleeping ? 1 : 0; }
   void LoadPlanetConstants(void);
   void LoadModelConstants(void);
   bool Allocate(void);
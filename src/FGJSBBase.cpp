@@ -38,9 +38,11 @@ INCLUDES
 #define BASE
 
 #include "FGJSBBase.h"
+#include "math/FGRandom.h"
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
+#include <mutex>
 
 using namespace std;
 
@@ -114,14 +116,16 @@ queue <FGJSBBase::Message> FGJSBBase::Messages;
 FGJSBBase::Message FGJSBBase::localMsg;
 unsigned int FGJSBBase::messageId = 0;
 
-int FGJSBBase::gaussian_random_number_phase = 0;
-
 short FGJSBBase::debug_lvl  = 0;
 
+// The messages can be put by FDMs executed concurrently (child FDMs, clones).
+static mutex MessagesMutex;
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGJSBBase::PutMessage(const Message& msg)
 {
+  lock_guard<mutex> lock(MessagesMutex);
   Messages.push(msg);
 }
 
@@ -131,9 +135,11 @@ void FGJSBBase::PutMessage(const string& text)
 {
   Message msg;
   msg.text = text;
-  msg.messageId = messageId++;
   msg.subsystem = "FDM";
   msg.type = Message::eText;
+
+  lock_guard<mutex> lock(MessagesMutex);
+  msg.messageId = messageId++;
   Messages.push(msg);
 }
 
@@ -143,10 +149,12 @@ void FGJSBBase::PutMessage(const string& text, bool bVal)
 {
   Message msg;
   msg.text = text;
-  msg.messageId = messageId++;
   msg.subsystem = "FDM";
   msg.type = Message::eBool;
   msg.bVal = bVal;
+
+  lock_guard<mutex> lock(MessagesMutex);
+  msg.messageId = messageId++;
   Messages.push(msg);
 }
 
@@ -156,10 +164,12 @@ void FGJSBBase::PutMessage(const string& text, int iVal)
 {
   Message msg;
   msg.text = text;
-  msg.messageId = messageId++;
   msg.subsystem = "FDM";
   msg.type = Message::eInteger;
   msg.iVal = iVal;
+
+  lock_guard<mutex> lock(MessagesMutex);
+  msg.messageId = messageId++;
   Messages.push(msg);
 }
 
@@ -169,10 +179,12 @@ void FGJSBBase::PutMessage(const string& text, double dVal)
 {
   Message msg;
   msg.text = text;
-  msg.messageId = messageId++;
   msg.subsystem = "FDM";
   msg.type = Message::eDouble;
   msg.dVal = dVal;
+
+  lock_guard<mutex> lock(MessagesMutex);
+  msg.messageId = messageId++;
   Messages.push(msg);
 }
 
@@ -180,6 +192,8 @@ void FGJSBBase::PutMessage(const string& text, double dVal)
 
 void FGJSBBase::ProcessMessage(void)
 {
+  lock_guard<mutex> lock(MessagesMutex);
+
   if (Messages.empty()) return;
   localMsg = Messages.front();
 
@@ -212,6 +226,8 @@ void FGJSBBase::ProcessMessage(void)
 
 FGJSBBase::Message* FGJSBBase::ProcessNextMessage(void)
 {
+  lock_guard<mutex> lock(MessagesMutex);
+
   if (Messages.empty()) return NULL;
   localMsg = Messages.front();
 
@@ -246,31 +262,34 @@ string FGJSBBase::CreateIndexedPropertyName(const string& Property, int index)
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The dispersions use their own stream so that they are independent of the
+// sequence of the FGFDMExec instance seeded with the same value.
 
-double FGJSBBase::GaussianRandomNumber(void)
+static FGRandom& DispersionRandom(void)
 {
-  static double V1, V2, S;
-  double X;
+  static thread_local FGRandom generator(0, 1);
+  return generator;
+}
 
-  if (gaussian_random_number_phase == 0) {
-    V1 = V2 = S = X = 0.0;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-    do {
-      double U1 = (double)rand() / RAND_MAX;
-      double U2 = (double)rand() / RAND_MAX;
+void FGJSBBase::SeedDispersions(unsigned int seed)
+{
+  DispersionRandom().Seed(seed);
+}
 
-      V1 = 2 * U1 - 1;
-      V2 = 2 * U2 - 1;
-      S = V1 * V1 + V2 * V2;
-    } while(S >= 1 || S == 0);
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-    X = V1 * sqrt(-2 * log(S) / S);
-  } else
-    X = V2 * sqrt(-2 * log(S) / S);
+double FGJSBBase::GaussianRandomNumber(void)
+{
+  return DispersionRandom().GetNormal();
+}
 
-  gaussian_random_number_phase = 1 - gaussian_random_number_phase;
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-  return X;
+double FGJSBBase::UniformRandomNumber(void)
+{
+  return DispersionRandom().GetUniformSigned();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -340,7 +340,18 @@ public:
   
   static double sign(double num) {return num>=0.0?1.0:-1.0;}
 
+  /** Random numbers used to disperse the values read from the XML files.
+      Each thread owns its own FGRandom generator so models can be loaded
+      concurrently. It is seeded by FGFDMExec::LoadModel() with the
+      simulation/randomseed of the loading instance. The simulation itself
+      uses the generator of its FGFDMExec instance.
+      @return a normally distributed number (zero mean, unit variance) */
   static double GaussianRandomNumber(void);
+  /// @return a uniformly distributed number in [-1, 1)
+  static double UniformRandomNumber(void);
+  /** Restarts the dispersions of the calling thread.
+      @param seed the new seed */
+  static void SeedDispersions(unsigned int seed);
 
 protected:
   static Message localMsg;
@@ -376,8 +387,6 @@ protected:
 
   static std::string CreateIndexedPropertyName(const std::string& Property, int index);
 
-  static int gaussian_random_number_phase;
-
 public:
 /// Moments L, M, N
 enum {eL     = 1, eM,     eN    };
@@ -0,0 +1,612 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGMonteCarlo.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Monte Carlo campaigns of scripts
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#include "FGMonteCarlo.h"
+#include "FGFDMExec.h"
+#include "FGThreadPool.h"
+#include "initialization/FGInitialCondition.h"
+#include "initialization/FGTrim.h"
+#include "input_output/FGPropertyManager.h"
+#include "input_output/FGScript.h"
+#include "input_output/FGXMLFileRead.h"
+#include "math/FGRandom.h"
+#include "models/FGInput.h"
+#include "models/atmosphere/FGWinds.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGMonteCarlo.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_MONTECARLO);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Writes the records of the cases in their order, whatever the order in which
+// the cases complete.
+
+class FGMonteCarloResults
+{
+public:
+  FGMonteCarloResults(const SGPath& results) : NextCase(0), NumFailed(0)
+  {
+    File.open(results.utf8Str().c_str(), ios::out | ios::binary | ios::trunc);
+    if (!File.is_open())
+      throw string("FGMonteCarlo: could not open the file " + results.utf8Str());
+  }
+
+  void WriteHeader(unsigned int nCases, const vector<string>& inputs,
+                   const vector<string>& metrics)
+  {
+    string header;
+    header.append("JSBSIMMC", 8);
+    Append(header, (unsigned int)1);
+    Append(header, nCases);
+    Append(header, (unsigned int)inputs.size());
+    Append(header, (unsigned int)metrics.size());
+    for (unsigned int i=0; i<inputs.size(); i++) Append(header, inputs[i]);
+    for (unsigned int i=0; i<metrics.size(); i++) Append(header, metrics[i]);
+    File.write(header.data(), header.size());
+  }
+
+  void Write(unsigned int index, int status, const string& record)
+  {
+    lock_guard<mutex> lock(Mutex);
+
+    if (status != FGMonteCarlo::eCompleted) NumFailed++;
+
+    Pending[index] = record;
+    while (!Pending.empty() && Pending.begin()->first == NextCase) {
+      File.write(Pending.begin()->second.data(), Pending.begin()->second.size());
+      Pending.erase(Pending.begin());
+      NextCase++;
+    }
+  }
+
+  unsigned int GetNumFailed(void) const { return NumFailed; }
+
+  template <class T> static void Append(string& buffer, const T& value)
+  { buffer.append((const char*)&value, sizeof(T)); }
+
+  static void Append(string& buffer, const string& value)
+  {
+    Append(buffer, (unsigned int)value.size());
+    buffer.append(value);
+  }
+
+private:
+  ofstream File;
+  mutex Mutex;
+  map<unsigned int, string> Pending;
+  unsigned int NextCase;
+  unsigned int NumFailed;
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Runs one case per job on the executive of the worker thread.
+
+class FGMonteCarloCases : public FGThreadPool::Task
+{
+public:
+  FGMonteCarloCases(const FGMonteCarlo& campaign, FGMonteCarloResults& results)
+    : Campaign(campaign), Results(results) {}
+
+  ~FGMonteCarloCases()
+  {
+    for (unsigned int i=0; i<Workers.size(); i++) {
+      delete Workers[i].IC;
+      delete Workers[i].fdm;
+    }
+  }
+
+  // The workers are created beforehand in the calling thread.
+  void AddWorker(FGFDMExec* parent)
+  {
+    Workers.push_back(Worker());
+    Worker& w = Workers.back();
+
+    w.IC = 0;
+    w.fdm = new FGFDMExec(parent->GetGroundCallback());
+    w.fdm->SetRootDir(parent->GetRootDir());
+    // Unlike the root directory, the paths of the parent are not relative to
+    // it once they have been set.
+    w.fdm->SetAircraftPath(parent->GetAircraftPath().realpath());
+    w.fdm->SetEnginePath(parent->GetEnginePath().realpath());
+    w.fdm->SetSystemsPath(parent->GetSystemsPath().realpath());
+    if (!w.fdm->LoadScript(Campaign.ScriptName))
+      throw string("FGMonteCarlo: the script " + Campaign.ScriptName.utf8Str()
+                   + " could not be loaded");
+    w.fdm->DisableOutput();
+    w.fdm->GetInput()->Disable();
+    w.fdm->GetScript()->SetSilent(true);
+    w.fdm->GetWinds()->ShareWindField(parent->GetWinds());
+
+    w.IC = new FGInitialCondition(w.fdm);
+    *w.IC = *w.fdm->GetIC();
+    SaveState(w.fdm->GetPropertyManager()->GetNode(), w.State, true);
+    w.RandomSeed = GetNode(w.fdm, "simulation/randomseed");
+
+    for (unsigned int i=0; i<Campaign.Dispersions.size(); i++)
+      w.Inputs.push_back(GetNode(w.fdm, Campaign.Dispersions[i].Property));
+    for (unsigned int i=0; i<Campaign.Failures.size(); i++)
+      w.Inputs.push_back(GetNode(w.fdm, Campaign.Failures[i].Property));
+    for (unsigned int i=0; i<w.Inputs.size(); i++)
+      w.Nominal.push_back(w.Inputs[i]->getDoubleValue());
+    for (unsigned int i=0; i<Campaign.Metrics.size(); i++)
+      w.Metrics.push_back(GetNode(w.fdm, Campaign.Metrics[i].Property));
+  }
+
+  void Execute(unsigned int index, unsigned int worker)
+  {
+    Worker& w = Workers[worker];
+    FGFDMExec* fdm = w.fdm;
+    unsigned int nDisp = Campaign.Dispersions.size();
+    unsigned int nFail = Campaign.Failures.size();
+    unsigned int nMetrics = Campaign.Metrics.size();
+    FGRandom random(Campaign.Seed, index);
+    unsigned int seed = (unsigned int)(random.GetUniform() * 2147483648.0);
+    vector<double> inputs(nDisp+nFail), metrics(nMetrics, 0.0);
+    vector<bool> failed(nFail, false);
+    int status = FGMonteCarlo::eCompleted;
+
+    // Restore the nominal case then disperse it. The controls, the filters,
+    // etc. are restored as well so that a case does not depend on the cases
+    // previously run by the worker.
+    for (unsigned int i=0; i<w.State.size(); i++) {
+      if (w.State[i].first->getDoubleValue() != w.State[i].second)
+        w.State[i].first->setDoubleValue(w.State[i].second);
+    }
+    *fdm->GetIC() = *w.IC;
+    for (unsigned int i=0; i<w.Inputs.size(); i++)
+      w.Inputs[i]->setDoubleValue(w.Nominal[i]);
+
+    for (unsigned int i=0; i<nDisp; i++) {
+      const FGMonteCarlo::Dispersion& d = Campaign.Dispersions[i];
+      double r = d.Type == FGMonteCarlo::eGaussian ? random.GetNormal()
+                                                   : random.GetUniformSigned();
+      inputs[i] = w.Nominal[i] + d.Value * r;
+    }
+
+    for (unsigned int i=0; i<nFail; i++) {
+      const FGMonteCarlo::Failure& f = Campaign.Failures[i];
+      bool occurs = random.GetUniform() < f.Probability;
+      double time = f.Start + random.GetUniform() * (f.End - f.Start);
+      inputs[nDisp+i] = occurs ? time : -1.0;
+    }
+
+    unsigned int nSamples = 0;
+
+    try {
+      // The models latch some of their inputs when they are reset (engine
+      // temperatures, ...) so a first reset flushes the state left by the
+      // previous case. The reset also reinitializes some properties (tank
+      // contents, ...) so the dispersions are written again after it.
+      Disperse(w, inputs, true);
+      fdm->ResetToInitialConditions(0);
+      Disperse(w, inputs, false);
+      w.RandomSeed->setIntValue((int)seed);
+      fdm->ResetToInitialConditions(0);
+      Disperse(w, inputs, false);
+
+      if (fdm->GetIC()->NeedTrim()) {
+        FGTrim trim(fdm, (TrimMode)fdm->GetIC()->TrimRequested());
+        if (!trim.DoTrim()) status = FGMonteCarlo::eTrimFailed;
+      }
+
+      if (status == FGMonteCarlo::eCompleted) {
+        Sample(w, metrics, nSamples++);
+
+        while (true) {
+          double time = fdm->GetSimTime();
+
+          for (unsigned int i=0; i<nFail; i++) {
+            if (!failed[i] && inputs[nDisp+i] >= 0.0 && time >= inputs[nDisp+i]) {
+              w.Inputs[nDisp+i]->setDoubleValue(Campaign.Failures[i].Value);
+              failed[i] = true;
+            }
+          }
+
+          if (!fdm->Run()) break;
+          Sample(w, metrics, nSamples++);
+
+          if (Campaign.EndTime > 0.0 && fdm->GetSimTime() >= Campaign.EndTime)
+            break;
+        }
+      }
+    } catch (...) {
+      status = FGMonteCarlo::eAborted;
+    }
+
+    for (unsigned int i=0; i<nMetrics; i++)
+      if (Campaign.Metrics[i].Type == FGMonteCarlo::eMean && nSamples > 0)
+        metrics[i] /= nSamples;
+
+    string record;
+    FGMonteCarloResults::Append(record, index);
+    FGMonteCarloResults::Append(record, seed);
+    FGMonteCarloResults::Append(record, status);
+    FGMonteCarloResults::Append(record, fdm->GetSimTime());
+    for (unsigned int i=0; i<inputs.size(); i++)
+      FGMonteCarloResults::Append(record, inputs[i]);
+    for (unsigned int i=0; i<nMetrics; i++)
+      FGMonteCarloResults::Append(record, metrics[i]);
+
+    Results.Write(index, status, record);
+  }
+
+private:
+  struct Worker {
+    FGFDMExec* fdm;
+    FGInitialCondition* IC;            // nominal initial conditions
+    FGPropertyNode* RandomSeed;
+    vector<FGPropertyNode*> Inputs;    // dispersions then failures
+    vector<double> Nominal;
+    vector<FGPropertyNode*> Metrics;
+    vector<pair<FGPropertyNode*, double> > State; // writable properties
+  };
+
+  const FGMonteCarlo& Campaign;
+  FGMonteCarloResults& Results;
+  vector<Worker> Workers;
+
+  void Disperse(Worker& w, const vector<double>& inputs, bool ic)
+  {
+    for (unsigned int i=0; i<Campaign.Dispersions.size(); i++) {
+      if (ic || Campaign.Dispersions[i].Property.compare(0, 3, "ic/") != 0)
+        w.Inputs[i]->setDoubleValue(inputs[i]);
+    }
+  }
+
+  void Sample(Worker& w, vector<double>& metrics, unsigned int n)
+  {
+    for (unsigned int i=0; i<metrics.size(); i++) {
+      double value = w.Metrics[i]->getDoubleValue();
+
+      switch (Campaign.Metrics[i].Type) {
+      case FGMonteCarlo::eMin:
+        if (n == 0 || value < metrics[i]) metrics[i] = value;
+        break;
+      case FGMonteCarlo::eMax:
+        if (n == 0 || value > metrics[i]) metrics[i] = value;
+        break;
+      case FGMonteCarlo::eMean:
+        metrics[i] += value;
+        break;
+      default:
+        metrics[i] = value;
+      }
+    }
+  }
+
+  // Same selection of properties as FGFDMExec::Clone()
+  static void SaveState(FGPropertyNode* node,
+                        vector<pair<FGPropertyNode*, double> >& state,
+                        bool topLevel)
+  {
+    for (int i=0; i<node->nChildren(); i++) {
+      FGPropertyNode* child = (FGPropertyNode*)node->getChild(i);
+      string name = child->getName();
+
+      if (topLevel && (name == "simulation" || name == "ic")) continue;
+
+      if (child->nChildren() > 0) {
+        SaveState(child, state, false);
+        continue;
+      }
+
+      if (!child->getAttribute(SGPropertyNode::READ) ||
+          !child->getAttribute(SGPropertyNode::WRITE))
+        continue;
+
+      switch (child->getType()) {
+      case simgear::props::BOOL:
+      case simgear::props::INT:
+      case simgear::props::LONG:
+      case simgear::props::FLOAT:
+      case simgear::props::DOUBLE:
+        state.push_back(make_pair(child, child->getDoubleValue()));
+        break;
+      default:
+        break;
+      }
+    }
+  }
+
+  static FGPropertyNode* GetNode(FGFDMExec* fdm, const string& name)
+  {
+    FGPropertyNode* node = fdm->GetPropertyManager()->GetNode(name);
+    if (!node)
+      throw string("FGMonteCarlo: property " + name + " does not exist");
+    return node;
+  }
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGMonteCarlo::FGMonteCarlo(FGFDMExec* FDMExec)
+  : fdmex(FDMExec), NumCases(0), Seed(0), EndTime(0.0), NumFailed(0)
+{
+  Debug(0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGMonteCarlo::~FGMonteCarlo(void)
+{
+  Debug(1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMonteCarlo::Load(const SGPath& file)
+{
+  SGPath path(file);
+  if (path.isRelative()) path = fdmex->GetRootDir()/file.utf8Str();
+
+  FGXMLFileRead XMLFileRead;
+  Element* document = XMLFileRead.LoadXMLDocument(path);
+
+  if (!document) {
+    cerr << "File: " << path << " could not be loaded." << endl;
+    return false;
+  }
+
+  return Load(document);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMonteCarlo::Load(Element* el)
+{
+  if (el->GetName() != "campaign") {
+    cerr << el->ReadFrom() << "File is not a campaign file" << endl;
+    return false;
+  }
+
+  if (el->HasAttribute("script"))
+    ScriptName = SGPath::fromLocal8Bit(el->GetAttributeValue("script").c_str());
+  if (el->HasAttribute("cases"))
+    NumCases = (unsigned int)el->GetAttributeValueAsNumber("cases");
+  if (el->HasAttribute("seed"))
+    Seed = (unsigned int)el->GetAttributeValueAsNumber("seed");
+  if (el->HasAttribute("end_time"))
+    EndTime = el->GetAttributeValueAsNumber("end_time");
+
+  Element* dispersion = el->FindElement("dispersion");
+  while (dispersion) {
+    string type = dispersion->GetAttributeValue("type");
+    eDispersion dtype;
+
+    if (type == "gaussian")
+      dtype = eGaussian;
+    else if (type == "uniform")
+      dtype = eUniform;
+    else {
+      cerr << dispersion->ReadFrom() << "Unknown dispersion type " << type << endl;
+      return false;
+    }
+
+    AddDispersion(dispersion->GetAttributeValue("property"), dtype,
+                  dispersion->GetAttributeValueAsNumber("value"));
+    dispersion = el->FindNextElement("dispersion");
+  }
+
+  Element* failure = el->FindElement("failure");
+  while (failure) {
+    double start = 0.0, end = 0.0;
+    if (failure->HasAttribute("start"))
+      start = failure->GetAttributeValueAsNumber("start");
+    if (failure->HasAttribute("end"))
+      end = failure->GetAttributeValueAsNumber("end");
+    else
+      end = start;
+
+    AddFailure(failure->GetAttributeValue("property"),
+               failure->GetAttributeValueAsNumber("value"),
+               failure->GetAttributeValueAsNumber("probability"), start, end);
+    failure = el->FindNextElement("failure");
+  }
+
+  Element* metric = el->FindElement("metric");
+  while (metric) {
+    string type = metric->GetAttributeValue("type");
+    eMetric mtype;
+
+    if (type.empty() || type == "final")
+      mtype = eFinal;
+    else if (type == "min")
+      mtype = eMin;
+    else if (type == "max")
+      mtype = eMax;
+    else if (type == "mean")
+      mtype = eMean;
+    else {
+      cerr << metric->ReadFrom() << "Unknown metric type " << type << endl;
+      return false;
+    }
+
+    AddMetric(metric->GetAttributeValue("property"), mtype);
+    metric = el->FindNextElement("metric");
+  }
+
+  Debug(2);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMonteCarlo::AddDispersion(const string& property, eDispersion type,
+                                 double value)
+{
+  Dispersion d;
+  d.Property = property;
+  d.Type = type;
+  d.Value = value;
+  Dispersions.push_back(d);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMonteCarlo::AddFailure(const string& property, double value,
+                              double probability, double start, double end)
+{
+  Failure f;
+  f.Property = property;
+  f.Value = value;
+  f.Probability = probability;
+  f.Start = start;
+  f.End = end;
+  Failures.push_back(f);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMonteCarlo::AddMetric(const string& property, eMetric type)
+{
+  Metric m;
+  m.Property = property;
+  m.Type = type;
+  Metrics.push_back(m);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMonteCarlo::Run(const SGPath& results, unsigned int nThreads)
+{
+  static const char* MetricNames[] = {"final", "min", "max", "mean"};
+
+  NumFailed = 0;
+  if (ScriptName.isNull())
+    throw string("FGMonteCarlo: no script has been given");
+
+  vector<string> inputs, metrics;
+  for (unsigned int i=0; i<Dispersions.size(); i++)
+    inputs.push_back(Dispersions[i].Property);
+  for (unsigned int i=0; i<Failures.size(); i++)
+    inputs.push_back(Failures[i].Property);
+  for (unsigned int i=0; i<Metrics.size(); i++)
+    metrics.push_back(string(MetricNames[Metrics[i].Type]) + "("
+                      + Metrics[i].Property + ")");
+
+  FGMonteCarloResults file(results);
+  file.WriteHeader(NumCases, inputs, metrics);
+  if (NumCases == 0) return true;
+
+  if (nThreads == 0) nThreads = FGThreadPool::GetHardwareConcurrency();
+  if (nThreads > NumCases) nThreads = NumCases;
+
+  // The cases would otherwise report their progress from all the threads.
+  int saved_debug_lvl = debug_lvl;
+  debug_lvl = 0;
+
+  try {
+    FGMonteCarloCases cases(*this, file);
+    for (unsigned int i=0; i<nThreads; i++)
+      cases.AddWorker(fdmex);
+
+    FGThreadPool pool(nThreads);
+    pool.Run(cases, NumCases);
+  } catch (...) {
+    debug_lvl = saved_debug_lvl;
+    throw;
+  }
+
+  debug_lvl = saved_debug_lvl;
+  NumFailed = file.GetNumFailed();
+
+  if (debug_lvl > 0)
+    cout << "  Monte Carlo campaign: " << NumCases - NumFailed << " out of "
+         << NumCases << " cases completed" << endl;
+
+  return NumFailed == 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//    The bitmasked value choices are as follows:
+//    unset: In this case (the default) JSBSim would only print
+//       out the normally expected messages, essentially echoing
+//       the config files as they are read. If the environment
+//       variable is not set, debug_lvl is set to 1 internally
+//    0: This requests JSBSim not to output any messages
+//       whatsoever.
+//    1: This value explicity requests the normal JSBSim
+//       startup messages
+//    2: This value asks for a message to be printed out when
+//       a class is instantiated
+//    4: When this value is set, a message is displayed when a
+//       FGModel object executes its Run() method
+//    8: When this value is set, various runtime state variables
+//       are printed out periodically
+//    16: When set various parameters are sanity checked and
+//       a message is printed out when they go out of bounds
+
+void FGMonteCarlo::Debug(int from)
+{
+  if (debug_lvl <= 0) return;
+
+  if (debug_lvl & 1) { // Standard console startup message output
+    if (from == 2) { // Load
+      cout << endl << "  Monte Carlo campaign: " << ScriptName << endl;
+      cout << "    " << NumCases << " cases, seed " << Seed << endl;
+      for (unsigned int i=0; i<Dispersions.size(); i++)
+        cout << "    Dispersion of " << Dispersions[i].Property << ": "
+             << (Dispersions[i].Type == eGaussian ? "gaussian " : "uniform ")
+             << Dispersions[i].Value << endl;
+      for (unsigned int i=0; i<Failures.size(); i++)
+        cout << "    Failure of " << Failures[i].Property << " to "
+             << Failures[i].Value << " with probability "
+             << Failures[i].Probability << endl;
+      for (unsigned int i=0; i<Metrics.size(); i++)
+        cout << "    Metric: " << Metrics[i].Property << endl;
+    }
+  }
+  if (debug_lvl & 2 ) { // Instantiation/Destruction notification
+    if (from == 0) cout << "Instantiated: FGMonteCarlo" << endl;
+    if (from == 1) cout << "Destroyed:    FGMonteCarlo" << endl;
+  }
+  if (debug_lvl & 64) {
+    if (from == 0) { // Constructor
+      cout << IdSrc << endl;
+      cout << IdHdr << endl;
+    }
+  }
+}
+}
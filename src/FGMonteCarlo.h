@@ -0,0 +1,228 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGMonteCarlo.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGMONTECARLO_H
+#define FGMONTECARLO_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "simgear/misc/sg_path.hxx"
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_MONTECARLO "$Id: FGMonteCarlo.h,v 1.0 2026/10/18 Outerra Exp $"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+class Element;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Runs a script many times with dispersed initial conditions, mass
+    properties, winds and failures (Monte Carlo campaign).
+
+    The campaign is described by an XML file:
+
+    @code
+    <campaign name="c172 cruise" script="scripts/c172_cruise_8K.xml"
+              cases="1000" seed="1">
+      <dispersion property="ic/h-sl-ft" type="gaussian" value="200"/>
+      <dispersion property="ic/vc-kts" type="uniform" value="10"/>
+      <dispersion property="inertia/pointmass-weight-lbs[0]" type="gaussian"
+                  value="20"/>
+      <failure property="propulsion/engine[0]/set-running" value="0"
+               probability="0.05" start="10" end="50"/>
+      <metric property="position/h-sl-ft" type="min"/>
+      <metric property="velocities/vc-kts" type="mean"/>
+      <metric property="attitude/phi-deg" type="max"/>
+    </campaign>
+    @endcode
+
+    - a dispersion adds value*N(0,1) (gaussian) or value*U(-1,1) (uniform)
+      to the nominal value of the property, that is its value once the script
+      has been loaded. The dispersions are applied before the initial
+      conditions are run so the ic/ properties can be used to disperse the
+      initial state and the winds.
+    - a failure sets the property to value with the given probability, at a
+      time drawn uniformly between start and end (both 0 by default).
+    - a metric summarizes a property over a case: its final, min, max or mean
+      value. The final value is the default.
+
+    The optional attribute end_time stops each case at the given time if the
+    script has not ended before.
+
+    Each worker thread owns an FGFDMExec instance on which the script is
+    loaded once; the cases are then run one after the other by resetting that
+    instance to its initial conditions. The dispersions and the failures of
+    case i are drawn from the stream i of an FGRandom seeded with the seed of
+    the campaign, and so is the simulation/randomseed of the case. A case
+    therefore gives the same results whatever the number of threads and the
+    order in which the cases are run.
+
+    The results are streamed in the order of the cases to a binary file made
+    of a header followed by one record per case. All the values are in the
+    native byte order of the machine:
+
+    - header: the 8 characters "JSBSIMMC", then the uint32 values version
+      (1), number of cases, number of dispersed inputs (dispersions then
+      failures) and number of metrics, then the name of each input and each
+      metric as a uint32 length followed by the characters. Inputs are named
+      after their property, metrics as type(property) e.g. max(attitude/phi-deg).
+    - record: uint32 case index, uint32 random seed, int32 status (0 the case
+      completed, 1 the trim failed, 2 an exception was thrown), double final
+      simulation time, then one double per input (the dispersed value, or the
+      failure time and a negative value if the failure did not occur) and one
+      double per metric.
+
+    @code
+    FGDefaultGroundCallback ground(20925646.32546);
+    FGFDMExec fdmex(&ground);
+    fdmex.SetRootDir(SGPath("/path/to/jsbsim"));
+    FGMonteCarlo campaign(&fdmex);
+    campaign.Load(SGPath("campaign.xml"));
+    campaign.Run(SGPath("campaign.bin"), 8);
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGMonteCarlo : public FGJSBBase
+{
+public:
+  /// Status of a case in the result file.
+  enum eStatus {eCompleted=0, eTrimFailed, eAborted};
+
+  /// Kind of a metric.
+  enum eMetric {eFinal=0, eMin, eMax, eMean};
+
+  /// Kind of a dispersion.
+  enum eDispersion {eGaussian=0, eUniform};
+
+  /** Constructor
+      @param fdmex the executive from which the root directory and the time
+                   step are taken. It is not modified by the campaign. */
+  FGMonteCarlo(FGFDMExec* fdmex);
+  ~FGMonteCarlo(void);
+
+  /** Loads a campaign file.
+      @param file name of the file, relative to the root directory
+      @return true if successful */
+  bool Load(const SGPath& file);
+
+  /** Loads a campaign from an XML element.
+      @param el the campaign element
+      @return true if successful */
+  bool Load(Element* el);
+
+  /// Overrides the script named by the campaign.
+  void SetScript(const SGPath& script) { ScriptName = script; }
+
+  /// Overrides the number of cases of the campaign.
+  void SetNumCases(unsigned int n) { NumCases = n; }
+  unsigned int GetNumCases(void) const { return NumCases; }
+
+  /// Overrides the seed of the campaign.
+  void SetSeed(unsigned int seed) { Seed = seed; }
+  unsigned int GetSeed(void) const { return Seed; }
+
+  void AddDispersion(const std::string& property, eDispersion type,
+                     double value);
+  void AddFailure(const std::string& property, double value,
+                  double probability, double start = 0.0, double end = 0.0);
+  void AddMetric(const std::string& property, eMetric type = eFinal);
+
+  /** Runs all the cases.
+      @param results name of the binary result file
+      @param nThreads number of threads, 0 for the number of hardware threads
+      @return true if all the cases have completed */
+  bool Run(const SGPath& results, unsigned int nThreads = 0);
+
+  /// Number of cases of the last run that did not complete.
+  unsigned int GetNumFailed(void) const { return NumFailed; }
+
+private:
+  struct Dispersion {
+    std::string Property;
+    eDispersion Type;
+    double Value;
+  };
+
+  struct Failure {
+    std::string Property;
+    double Value;
+    double Probability;
+    double Start;
+    double End;
+  };
+
+  struct Metric {
+    std::string Property;
+    eMetric Type;
+  };
+
+  FGFDMExec* fdmex;
+  SGPath ScriptName;
+  unsigned int NumCases;
+  unsigned int Seed;
+  double EndTime;
+  unsigned int NumFailed;
+  std::vector<Dispersion> Dispersions;
+  std::vector<Failure> Failures;
+  std::vector<Metric> Metrics;
+
+  friend class FGMonteCarloCases;
+
+  void Debug(int from);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
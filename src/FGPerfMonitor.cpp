@@ -0,0 +1,254 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGPerfMonitor.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Timing instrumentation of the FDM
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+#include "FGPerfMonitor.h"
+#include "FGJSBBase.h"
+#include "input_output/FGPropertyManager.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGPerfMonitor.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_PERFMONITOR);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Turns a name into a relative property path: each element of the path only
+// contains letters, digits, '_', '-' and '.' and starts with a letter or '_'.
+static string MakePath(const string& name)
+{
+  string path;
+  bool start = true;
+
+  for (unsigned int i=0; i<name.size(); i++) {
+    char c = name[i];
+    if (c == '/') {
+      if (!start) path += '/';
+      start = true;
+      continue;
+    }
+    if (!isalnum((unsigned char)c) && c != '_' && c != '-' && c != '.') c = '_';
+    if (start && !isalpha((unsigned char)c) && c != '_') path += '_';
+    path += c;
+    start = false;
+  }
+  if (!path.empty() && path[path.size()-1] == '/') path.erase(path.size()-1);
+
+  return path;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPerfMonitor::Entry::Entry(const string& path)
+  : Path(path), Published(false)
+{
+  Reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPerfMonitor::Entry::Add(long long ns)
+{
+  Count++;
+  Total += ns;
+  Last = ns;
+  if (ns > Max) Max = ns;
+
+  unsigned int bin = 0;
+  for (unsigned long long t = ns > 0 ? ns : 0; t > 1 && bin < NumBins-1; t >>= 1)
+    bin++;
+  Histogram[bin]++;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPerfMonitor::Entry::Reset(void)
+{
+  Count = 0;
+  Total = 0.0;
+  Last = Max = 0;
+  for (unsigned int i=0; i<NumBins; i++) Histogram[i] = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The bin i holds the times in [2^i, 2^(i+1)) ns; the geometric middle of the
+// bin is returned.
+
+double FGPerfMonitor::Entry::GetPercentileUs(double p) const
+{
+  if (Count == 0) return 0.0;
+
+  double target = p * Count;
+  unsigned long long sum = 0;
+  for (unsigned int i=0; i<NumBins; i++) {
+    sum += Histogram[i];
+    if (sum >= target && sum > 0) return ldexp(sqrt(2.0), i) * 1e-3;
+  }
+  return GetMaxUs();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPerfMonitor::FGPerfMonitor(FGPropertyManager* pm)
+  : PropertyManager(pm), Enabled(false), ReportAtExit(false)
+{
+  typedef int (FGPerfMonitor::*iPMF)(void) const;
+  PropertyManager->Tie("simulation/perf/enabled", this,
+                       &FGPerfMonitor::IsEnabled, &FGPerfMonitor::SetEnabled);
+  PropertyManager->Tie("simulation/perf/reset", this, (iPMF)0,
+                       &FGPerfMonitor::ResetCmd, false);
+  PropertyManager->Tie("simulation/perf/report", this, (iPMF)0,
+                       &FGPerfMonitor::ReportCmd, false);
+  PropertyManager->Tie("simulation/perf/report-at-exit", this,
+                       &FGPerfMonitor::GetReportAtExit,
+                       &FGPerfMonitor::SetReportAtExit);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPerfMonitor::~FGPerfMonitor()
+{
+  for (unsigned int i=0; i<Entries.size(); i++) delete Entries[i];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The properties of the entries are only created once the monitor is enabled
+// so that a disabled monitor does not grow the property tree.
+
+void FGPerfMonitor::SetEnabled(bool enabled)
+{
+  Enabled = enabled;
+  if (Enabled) {
+    for (unsigned int i=0; i<Entries.size(); i++) Publish(Entries[i]);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPerfMonitor::Entry* FGPerfMonitor::GetEntry(const string& prefix,
+                                              const string& name, int index)
+{
+  string path = prefix;
+  if (!name.empty()) path += "/" + name;
+  path = MakePath(path);
+  if (index >= 0) path += "[" + to_string(index) + "]";
+
+  map<string, Entry*>::iterator it = EntryMap.find(path);
+  if (it != EntryMap.end()) return it->second;
+
+  Entry* entry = new Entry(path);
+  Entries.push_back(entry);
+  EntryMap[path] = entry;
+  if (Enabled) Publish(entry);
+
+  return entry;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPerfMonitor::Publish(Entry* entry)
+{
+  if (entry->Published) return;
+
+  string base = "simulation/perf/" + entry->Path;
+  PropertyManager->Tie(base + "/count", entry, &Entry::GetCount);
+  PropertyManager->Tie(base + "/total-ms", entry, &Entry::GetTotalMs);
+  PropertyManager->Tie(base + "/last-us", entry, &Entry::GetLastUs);
+  PropertyManager->Tie(base + "/mean-us", entry, &Entry::GetMeanUs);
+  PropertyManager->Tie(base + "/max-us", entry, &Entry::GetMaxUs);
+  PropertyManager->Tie(base + "/p50-us", entry, &Entry::GetP50Us);
+  PropertyManager->Tie(base + "/p99-us", entry, &Entry::GetP99Us);
+  entry->Published = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPerfMonitor::Reset(void)
+{
+  for (unsigned int i=0; i<Entries.size(); i++) Entries[i]->Reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static bool ByTotal(const FGPerfMonitor::Entry* a, const FGPerfMonitor::Entry* b)
+{
+  return a->GetTotalMs() > b->GetTotalMs();
+}
+
+void FGPerfMonitor::Report(ostream& out) const
+{
+  vector<const Entry*> entries;
+  for (unsigned int i=0; i<Entries.size(); i++)
+    if (Entries[i]->Count > 0) entries.push_back(Entries[i]);
+  sort(entries.begin(), entries.end(), ByTotal);
+
+  ios::fmtflags flags = out.flags();
+  streamsize precision = out.precision();
+
+  out << endl << "Performance report" << endl
+      << setw(12) << "total ms" << setw(12) << "count" << setw(10) << "mean us"
+      << setw(10) << "p50 us" << setw(10) << "p99 us" << setw(10) << "max us"
+      << "  path" << endl;
+  out << fixed;
+  for (unsigned int i=0; i<entries.size(); i++) {
+    const Entry* e = entries[i];
+    out << setprecision(3) << setw(12) << e->GetTotalMs()
+        << setw(12) << e->Count
+        << setprecision(3) << setw(10) << e->GetMeanUs()
+        << setw(10) << e->GetP50Us() << setw(10) << e->GetP99Us()
+        << setw(10) << e->GetMaxUs()
+        << "  " << e->Path << endl;
+  }
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPerfMonitor::ReportCmd(int)
+{
+  Report(cout);
+}
+
+}
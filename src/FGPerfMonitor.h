@@ -0,0 +1,211 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGPerfMonitor.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGPERFMONITOR_H
+#define FGPERFMONITOR_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <iosfwd>
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_PERFMONITOR "$Id: FGPerfMonitor.h,v 1.0 2026/10/18 Outerra Exp $"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyManager;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Records the execution times of the parts of an FDM.
+
+    Each timed part (a model, an FCS channel or component, an aerodynamic
+    function, an engine, ...) owns an Entry, obtained once at load time with
+    GetEntry(). Its execution is then wrapped in a Scope:
+
+    @code
+    FGPerfMonitor::Scope timer(perf, entry);
+    component->Run();
+    @endcode
+
+    While the monitor is disabled (the default) a Scope only tests a flag, so
+    the instrumentation costs nothing measurable. Once enabled with the
+    property simulation/perf/enabled, each entry accumulates the number of
+    executions, the total, last and maximum times and a histogram of the
+    times (one bin per power of 2 nanoseconds) from which the median and the
+    99th percentile are estimated. The entries are published in the property
+    tree under simulation/perf/<path>/ as count, total-ms, last-us, mean-us,
+    max-us, p50-us and p99-us. The paths are:
+    - frame: the whole FGFDMExec::Run(),
+    - models/<model>: FGModel::Run() of each model,
+    - fcs/<channel> and fcs/<channel>/<component>: the FCS channels and their
+      components (a compiled channel is only timed as a whole),
+    - aerodynamics/<function>: the functions of the aerodynamics,
+    - propulsion/engine[n]: FGEngine::Calculate() of each engine.
+
+    Writing to simulation/perf/reset clears the statistics and writing to
+    simulation/perf/report prints the report (see Report()) on the console.
+    The report is not printed when the FDM is destroyed unless
+    simulation/perf/report-at-exit is set to 1.
+
+    The entries are only created at load time by the thread loading the FDM;
+    after that, the scopes can be used by several threads provided that a
+    given entry is only used by one thread at a time.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGPerfMonitor
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  /// Timing statistics of a part of the FDM.
+  class JSBSIM_API Entry
+  {
+  public:
+    enum {NumBins = 40};
+
+    explicit Entry(const std::string& path);
+
+    /// Records an execution time in nanoseconds.
+    void Add(long long ns);
+    void Reset(void);
+
+    const std::string& GetPath(void) const { return Path; }
+    double GetCount(void) const { return (double)Count; }
+    double GetTotalMs(void) const { return Total * 1e-6; }
+    double GetLastUs(void) const { return Last * 1e-3; }
+    double GetMeanUs(void) const { return Count ? Total * 1e-3 / Count : 0.0; }
+    double GetMaxUs(void) const { return Max * 1e-3; }
+    /** Estimates a percentile from the histogram.
+        @param p the fraction of the executions (0 to 1)
+        @return the time in microseconds, accurate to a factor sqrt(2) */
+    double GetPercentileUs(double p) const;
+    double GetP50Us(void) const { return GetPercentileUs(0.5); }
+    double GetP99Us(void) const { return GetPercentileUs(0.99); }
+
+  private:
+    std::string Path;
+    unsigned long long Count;
+    double Total;         // [ns]
+    long long Last;       // [ns]
+    long long Max;        // [ns]
+    unsigned long long Histogram[NumBins];
+    bool Published;
+
+    friend class FGPerfMonitor;
+  };
+
+  /// Times the execution of a block of code.
+  class Scope
+  {
+  public:
+    Scope(const FGPerfMonitor* monitor, Entry* entry)
+      : Active(monitor->Enabled ? entry : 0)
+    {
+      if (Active) Start = Clock::now();
+    }
+    ~Scope()
+    {
+      if (Active)
+        Active->Add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      Clock::now() - Start).count());
+    }
+  private:
+    Entry* Active;
+    Clock::time_point Start;
+  };
+
+  /** Constructor
+      @param pm the property manager of the FDM under which the properties
+                simulation/perf/ are created. */
+  explicit FGPerfMonitor(FGPropertyManager* pm);
+  ~FGPerfMonitor();
+
+  bool IsEnabled(void) const { return Enabled; }
+  void SetEnabled(bool enabled);
+
+  /// True if the report is to be printed when the FDM is destroyed.
+  bool GetReportAtExit(void) const { return ReportAtExit; }
+  void SetReportAtExit(bool report) { ReportAtExit = report; }
+
+  /** Returns the entry of a part of the FDM, creating it if needed. The same
+      entry is returned for the same path.
+      @param prefix the category of the part (e.g. "fcs/yaw-damper")
+      @param name the name of the part. Characters that are not valid in a
+                  property name are replaced by '_'. May be empty.
+      @param index an index appended to the name, unless negative */
+  Entry* GetEntry(const std::string& prefix, const std::string& name,
+                  int index = -1);
+
+  /// Clears the statistics of all the entries.
+  void Reset(void);
+
+  /** Prints the entries that have been executed, sorted by decreasing total
+      time. */
+  void Report(std::ostream& out) const;
+
+private:
+  FGPropertyManager* PropertyManager;
+  bool Enabled;
+  bool ReportAtExit;
+  std::vector<Entry*> Entries;
+  std::map<std::string, Entry*> EntryMap;
+
+  void Publish(Entry* entry);
+  void ResetCmd(int) { Reset(); }
+  void ReportCmd(int);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
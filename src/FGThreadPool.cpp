@@ -0,0 +1,132 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGThreadPool.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Fixed size pool of worker threads
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGThreadPool.h"
+#include "FGJSBBase.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGThreadPool.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_THREADPOOL);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGThreadPool::FGThreadPool(unsigned int nThreads)
+  : CurrentTask(0), NextIndex(0), Count(0), Pending(0), Stopping(false)
+{
+  if (nThreads == 0) nThreads = GetHardwareConcurrency();
+
+  for (unsigned int i=0; i<nThreads; i++)
+    Workers.push_back(thread(&FGThreadPool::WorkerLoop, this, i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGThreadPool::~FGThreadPool()
+{
+  {
+    unique_lock<mutex> lock(Mutex);
+    Stopping = true;
+  }
+  WorkAvailable.notify_all();
+
+  for (unsigned int i=0; i<Workers.size(); i++) Workers[i].join();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGThreadPool::GetHardwareConcurrency(void)
+{
+  unsigned int n = thread::hardware_concurrency();
+  return n > 0 ? n : 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThreadPool::Run(Task& task, unsigned int count)
+{
+  if (count == 0) return;
+
+  exception_ptr error;
+  {
+    unique_lock<mutex> lock(Mutex);
+    CurrentTask = &task;
+    NextIndex = 0;
+    Count = count;
+    Pending = count;
+    Error = exception_ptr();
+    WorkAvailable.notify_all();
+
+    while (Pending > 0) WorkDone.wait(lock);
+
+    CurrentTask = 0;
+    error = Error;
+    Error = exception_ptr();
+  }
+
+  if (error) rethrow_exception(error);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThreadPool::WorkerLoop(unsigned int worker)
+{
+  unique_lock<mutex> lock(Mutex);
+
+  while (true) {
+    while (!Stopping && NextIndex >= Count) WorkAvailable.wait(lock);
+    if (Stopping) return;
+
+    unsigned int index = NextIndex++;
+    Task* task = CurrentTask;
+    lock.unlock();
+
+    exception_ptr error;
+    try {
+      task->Execute(index, worker);
+    } catch (...) {
+      error = current_exception();
+    }
+
+    lock.lock();
+    if (error && !Error) Error = error;
+    if (--Pending == 0) WorkDone.notify_all();
+  }
+}
+
+}
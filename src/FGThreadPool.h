@@ -0,0 +1,142 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGThreadPool.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTHREADPOOL_H
+#define FGTHREADPOOL_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_THREADPOOL "$Id: FGThreadPool.h,v 1.0 2026/10/18 Outerra Exp $"
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** A fixed size pool of worker threads executing indexed batches of tasks.
+
+    The pool is meant for the "fork-join" kind of parallelism found in JSBSim:
+    a batch of independent jobs (Jacobian columns, trim points, child FDMs,
+    Monte Carlo cases, ...) is submitted with Run() and the caller is blocked
+    until every job of the batch has completed.
+
+    Each job is given the index of the worker thread that executes it. Since a
+    worker only executes one job at a time, that index can be used to select
+    per-thread resources such as a cloned FGFDMExec instance without any
+    further locking:
+
+    @code
+    class Job : public FGThreadPool::Task {
+    public:
+      void Execute(unsigned int i, unsigned int worker) {
+        clones[worker]->Run();
+      }
+    };
+
+    FGThreadPool pool(4);
+    Job job;
+    pool.Run(job, n);
+    @endcode
+
+    The first exception thrown by a job is captured and rethrown by Run() in
+    the calling thread once the batch is complete.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGThreadPool
+{
+public:
+  /// Abstract job executed by the pool.
+  class Task
+  {
+  public:
+    virtual ~Task() {}
+    /** Executes one job of a batch.
+        @param index index of the job in the batch (0 to count-1)
+        @param worker index of the worker thread executing the job */
+    virtual void Execute(unsigned int index, unsigned int worker) = 0;
+  };
+
+  /** Constructor
+      @param nThreads number of worker threads. If zero, the number of
+                      hardware threads is used. */
+  explicit FGThreadPool(unsigned int nThreads = 0);
+  /// Destructor. Joins the worker threads.
+  ~FGThreadPool();
+
+  /// Returns the number of worker threads.
+  unsigned int GetNumThreads(void) const { return (unsigned int)Workers.size(); }
+
+  /** Executes task.Execute(i, worker) for i in [0, count) and waits for
+      all the jobs to complete. Batches must not be nested. */
+  void Run(Task& task, unsigned int count);
+
+  /// Returns the number of hardware threads (at least 1).
+  static unsigned int GetHardwareConcurrency(void);
+
+private:
+  std::vector<std::thread> Workers;
+  std::mutex Mutex;
+  std::condition_variable WorkAvailable;
+  std::condition_variable WorkDone;
+
+  Task* CurrentTask;
+  unsigned int NextIndex;
+  unsigned int Count;
+  unsigned int Pending;
+  bool Stopping;
+  std::exception_ptr Error;
+
+  void WorkerLoop(unsigned int worker);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -41,6 +41,7 @@ INCLUDES
 
 #include "initialization/FGTrim.h"
 #include "FGFDMExec.h"
+#include "FGMonteCarlo.h"
 #include "input_output/FGGroundCallback.h"
 #include "input_output/FGXMLFileRead.h"
 
@@ -92,6 +93,9 @@ vector <string> LogOutputName;
 vector <SGPath> LogDirectiveName;
 vector <string> CommandLineProperties;
 vector <double> CommandLinePropertyValues;
+SGPath CampaignName;
+SGPath CampaignResultName("campaign.bin");
+unsigned int campaign_threads = 0;
 JSBSim::FGFDMExec* FDMExec;
 JSBSim::FGTrim* trimmer;
 
@@ -112,6 +116,7 @@ FORWARD DECLARATIONS
 
 bool options(int, char**);
 int real_main(int argc, char* argv[]);
+int campaign_main(int argc, char* argv[]);
 void PrintHelp(void);
 
 #if defined(__BORLANDC__) || defined(_MSC_VER) || defined(__MINGW32__)
@@ -308,6 +313,12 @@ int main(int argc, char* argv[])
 
 int real_main(int argc, char* argv[])
 {
+  // *** MONTE CARLO CAMPAIGN *** //
+  for (int i=1; i<argc; i++) {
+    if (string(argv[i]).compare(0, 11, "--campaign=") == 0)
+      return campaign_main(argc, argv);
+  }
+
   /*// *** INITIALIZATIONS *** //
 
   ScriptName = "";
@@ -563,6 +574,41 @@ quit:
   return 0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Runs all the cases of a campaign in this process: the script is loaded once
+// per thread instead of once per case.
+
+int campaign_main(int argc, char* argv[])
+{
+  if (!options(argc, argv)) {
+    PrintHelp();
+    exit(-1);
+  }
+
+  FDMExec = new JSBSim::FGFDMExec(new JSBSim::FGDefaultGroundCallback(20925646.32546));
+  FDMExec->SetRootDir(RootDir);
+
+  JSBSim::FGMonteCarlo campaign(FDMExec);
+  if (!campaign.Load(CampaignName)) {
+    cerr << "Campaign file " << CampaignName << " was not successfully loaded" << endl;
+    delete FDMExec;
+    exit(-1);
+  }
+  if (!ScriptName.isNull()) campaign.SetScript(ScriptName);
+
+  double start = getcurrentseconds();
+  bool result = campaign.Run(CampaignResultName, campaign_threads);
+  double elapsed = getcurrentseconds() - start;
+
+  cout << campaign.GetNumCases() - campaign.GetNumFailed() << " out of "
+       << campaign.GetNumCases() << " cases completed in " << elapsed
+       << " s. Results written to " << CampaignResultName << endl;
+
+  delete FDMExec;
+
+  return result ? 0 : 1;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #define gripe cerr << "Option '" << keyword     \
@@ -695,6 +741,27 @@ bool options(int count, char **arg)
         exit(1);
       }
 
+    } else if (keyword == "--campaign") {
+      if (n != string::npos) {
+        CampaignName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--campaign-output") {
+      if (n != string::npos) {
+        CampaignResultName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
+    } else if (keyword == "--campaign-threads") {
+      if (n != string::npos) {
+        campaign_threads = atoi(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--catalog") {
         catalog = true;
         if (value.size() > 0) AircraftName=value;
@@ -769,7 +836,12 @@ void PrintHelp(void)
     cout << "    --simulation-rate=<rate (double)> specifies the sim dT time or frequency" << endl;
     cout << "                      If rate specified is less than 1, it is interpreted as" << endl;
     cout << "                      a time step size, otherwise it is assumed to be a rate in Hertz." << endl;
-    cout << "    --end=<time (double)> specifies the sim end time" << endl << endl;
+    cout << "    --end=<time (double)> specifies the sim end time" << endl;
+    cout << "    --campaign=<filename>  runs the Monte Carlo campaign described in the file" << endl;
+    cout << "    --campaign-output=<filename>  sets the binary result file of the campaign" << endl;
+    cout << "                                  (campaign.bin by default)" << endl;
+    cout << "    --campaign-threads=<n>  sets the number of threads running the campaign" << endl;
+    cout << "                            (the number of hardware threads by default)" << endl << endl;
 
     cout << "  NOTE: There can be no spaces around the = sign when" << endl;
     cout << "        an option is followed by a filename" << endl << endl;
@@ -53,6 +53,7 @@ INCLUDES
 #include "models/FGAircraft.h"
 #include "models/FGAccelerations.h"
 #include "input_output/FGXMLFileRead.h"
+#include "initialization/FGTrimDatabase.h"
 
 using namespace std;
 
@@ -86,6 +87,31 @@ FGInitialCondition::~FGInitialCondition()
 
 //******************************************************************************
 
+FGInitialCondition& FGInitialCondition::operator=(const FGInitialCondition& ic)
+{
+  vUVW_NED = ic.vUVW_NED;
+  vPQR_body = ic.vPQR_body;
+  position = ic.position;
+  orientation = ic.orientation;
+  vt = ic.vt;
+  targetNlfIC = ic.targetNlfIC;
+  Tw2b = ic.Tw2b;
+  Tb2w = ic.Tb2w;
+  alpha = ic.alpha;
+  beta = ic.beta;
+  a = ic.a;
+  e2 = ic.e2;
+  lastSpeedSet = ic.lastSpeedSet;
+  lastAltitudeSet = ic.lastAltitudeSet;
+  lastLatitudeSet = ic.lastLatitudeSet;
+  enginesRunning = ic.enginesRunning;
+  needTrim = ic.needTrim;
+
+  return *this;
+}
+
+//******************************************************************************
+
 void FGInitialCondition::ResetIC(double u0, double v0, double w0,
                                  double p0, double q0, double r0,
                                  double alpha0, double beta0,
@@ -930,6 +956,38 @@ bool FGInitialCondition::Load(const SGPath& rstfile, bool useStoredPath)
   return result;
 }
 
+//******************************************************************************
+
+bool FGInitialCondition::SetFromTrimDatabase(const FGTrimDatabase& db)
+{
+  FGPropertyManager* pm = fdmex->GetPropertyManager();
+  vector<double> keys(db.GetNumDimensions()), outputs;
+
+  for (unsigned int i=0; i<db.GetNumDimensions(); i++) {
+    FGPropertyNode* node = pm->GetNode(db.GetDimensionName(i));
+    if (!node) {
+      cerr << "The trim database property " << db.GetDimensionName(i)
+           << " does not exist." << endl;
+      return false;
+    }
+    keys[i] = node->getDoubleValue();
+  }
+
+  if (!db.Interpolate(keys, outputs)) return false;
+
+  for (unsigned int j=0; j<db.GetNumOutputs(); j++) {
+    FGPropertyNode* node = pm->GetNode(db.GetOutputName(j));
+    if (!node) {
+      cerr << "The trim database property " << db.GetOutputName(j)
+           << " does not exist." << endl;
+      return false;
+    }
+    node->setDoubleValue(outputs[j]);
+  }
+
+  return true;
+}
+
 //******************************************************************************
 // Given an altitude above the mean sea level (or a position radius which is the
 // same) and a geodetic latitude, compute the geodetic altitude.
@@ -71,6 +71,7 @@ class FGColumnVector3;
 class FGAtmosphere;
 class FGAircraft;
 class FGPropertyManager;
+class FGTrimDatabase;
 class Element;
 
 typedef enum { setvt, setvc, setve, setmach, setuvw, setned, setvg } speedset;
@@ -238,6 +239,12 @@ public:
   /// Destructor
   ~FGInitialCondition();
 
+  /** Copies the initial conditions of another instance. The FGFDMExec
+      instance this object belongs to is left unchanged so that initial
+      conditions can be transferred between instances of the same aircraft.
+      @param ic the initial conditions to copy */
+  FGInitialCondition& operator=(const FGInitialCondition& ic);
+
   /** Set calibrated airspeed initial condition in knots.
       @param vc Calibrated airspeed in knots  */
   void SetVcalibratedKtsIC(double vc);
@@ -682,6 +689,19 @@ public:
       @return true if successful */
   bool Load(const SGPath& rstname, bool useStoredPath = true );
 
+  /** Sets the trim related initial conditions and controls by interpolating
+      a trim database (see FGTrimSweep). The flight condition is read from the
+      properties of the database dimensions (ic/h-sl-ft, ic/vc-kts, ...) so
+      the initial conditions and the aircraft configuration must be set
+      beforehand. The interpolated outputs (ic/alpha-deg,
+      fcs/throttle-cmd-norm, ...) are then written to the properties of the
+      executive, so this method is meant for the executive's own initial
+      conditions (FGFDMExec::GetIC()).
+      @param db the trim database
+      @return false if a property is missing or if the database has no
+              trimmed point around the flight condition */
+  bool SetFromTrimDatabase(const FGTrimDatabase& db);
+
   /** Is an engine running ?
       @param index of the engine to be checked
       @return true if the engine is running. */
@@ -691,6 +711,9 @@ public:
       @return true if initialization file (version 1) called for trim. */
   bool NeedTrim(void) const { return needTrim == 0 ? false : true; }
 
+  /// Returns the trim mode requested by the initialization file.
+  int TrimRequested(void) const { return needTrim; }
+
   void bind(FGPropertyManager* pm);
 
   void InitializeIC(void);
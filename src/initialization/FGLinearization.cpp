@@ -18,13 +18,14 @@
 
 #include "FGInitialCondition.h"
 #include "FGLinearization.h"
+#include "FGThreadPool.h"
 #include <ctime>
 
 namespace JSBSim {
 
 // TODO make FGLinearization have X,U,Y selectable by xml config file
 
-FGLinearization::FGLinearization(FGFDMExec * fdm, int mode)
+FGLinearization::FGLinearization(FGFDMExec * fdm, int mode, unsigned int numThreads)
 {
     std::cout << "\nlinearization: " << std::endl;
     std::clock_t time_start=clock(), time_linDone;
@@ -74,7 +75,36 @@ FGLinearization::FGLinearization(FGFDMExec * fdm, int mode)
     std::vector<double> y0 = x0; // state feedback
     std::cout << ss << std::endl;
 
-    ss.linearize(x0,u0,y0,A,B,C,D);
+    if (numThreads == 0) numThreads = FGThreadPool::GetHardwareConcurrency();
+    if (numThreads > 1)
+    {
+        FGThreadPool pool(numThreads);
+        std::vector<FGFDMExec *> clones;
+        for (unsigned int i=0;i<pool.GetNumThreads();i++)
+        {
+            FGFDMExec * clone = fdm->Clone();
+            if (!clone)
+            {
+                for (unsigned int j=0;j<clones.size();j++) delete clones[j];
+                throw std::runtime_error("FGLinearization: failed to clone the model");
+            }
+            clones.push_back(clone);
+        }
+        try
+        {
+            ss.linearize(x0,u0,y0,A,B,C,D,pool,clones);
+        }
+        catch (...)
+        {
+            for (unsigned int i=0;i<clones.size();i++) delete clones[i];
+            throw;
+        }
+        for (unsigned int i=0;i<clones.size();i++) delete clones[i];
+    }
+    else
+    {
+        ss.linearize(x0,u0,y0,A,B,C,D);
+    }
 
     int width=10;
     std::cout.precision(3);
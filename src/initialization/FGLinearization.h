@@ -37,7 +37,17 @@ namespace JSBSim {
 class FGLinearization
 {
 public:
-    FGLinearization(FGFDMExec * fdmPtr, int mode);
+    /**
+     * Linearizes the model about its current (trimmed) initial conditions.
+     * @param fdmPtr the flight dynamics model
+     * @param mode unused
+     * @param numThreads number of threads used to evaluate the Jacobians,
+     *        1 evaluates them serially, 0 uses all the hardware threads.
+     *        When more than one thread is used, the model is cloned once per
+     *        thread (see FGFDMExec::Clone) and the columns of A, B, C and D
+     *        are computed concurrently.
+     */
+    FGLinearization(FGFDMExec * fdmPtr, int mode, unsigned int numThreads = 1);
 };
 
 } // JSBSim
@@ -18,10 +18,105 @@
 
 #include "FGTrim.h"
 #include "FGSimplexTrim.h"
+#include "FGThreadPool.h"
+#include "math/FGRandom.h"
 #include <ctime>
+#include <limits>
+#include <memory>
 
 namespace JSBSim {
 
+namespace {
+
+// Runs independent simplex searches. When the searches run on clones, each
+// search first copies the state of the FDM to the clone of its worker thread
+// so that its result does not depend on the searches run before it.
+class SimplexStarts : public FGThreadPool::Task
+{
+public:
+    struct Settings
+    {
+        std::vector<double> lowerBound, upperBound, initialStepSize;
+        int iterMax;
+        double rtol, abstol, speed, random;
+        bool showConvergence, showSimplex, pause;
+        unsigned int seed;
+        std::string logName;
+    };
+
+    SimplexStarts(const Settings & settings, FGTrimmer::Constraints & constraints,
+                  FGFDMExec * fdm, const std::vector<FGFDMExec*> & clones,
+                  const std::vector< std::vector<double> > & guesses) :
+        m_settings(settings), m_constraints(constraints), m_fdm(fdm),
+        m_clones(clones), m_guesses(guesses), m_solutions(guesses.size()),
+        m_costs(guesses.size(), std::numeric_limits<double>::max()),
+        m_errors(guesses.size())
+    {
+    }
+
+    void Execute(unsigned int start, unsigned int worker)
+    {
+        FGFDMExec * fdm = m_fdm;
+        if (!m_clones.empty())
+        {
+            fdm = m_clones[worker];
+            fdm->CopyStateFrom(m_fdm);
+        }
+
+        FGTrimmer trimmer(fdm, &m_constraints);
+        // only the first start reports its progress
+        bool first = start == 0;
+        std::unique_ptr<FGSimplexTrim::Callback> callback;
+        if (first) callback.reset(new FGSimplexTrim::Callback(m_settings.logName, &trimmer));
+
+        FGNelderMead solver(&trimmer, m_guesses[start], m_settings.lowerBound,
+            m_settings.upperBound, m_settings.initialStepSize, m_settings.iterMax,
+            m_settings.rtol, m_settings.abstol, m_settings.speed, m_settings.random,
+            first && m_settings.showConvergence, first && m_settings.showSimplex,
+            first && m_settings.pause, callback.get(), m_settings.seed, start + 1);
+        try
+        {
+            while(solver.status()==1) solver.update();
+            m_solutions[start] = solver.getSolution();
+            m_costs[start] = trimmer.eval(m_solutions[start]);
+        }
+        catch (const std::exception & e)
+        {
+            m_errors[start] = e.what();
+        }
+        catch (const std::string & msg)
+        {
+            m_errors[start] = msg;
+        }
+    }
+
+    /// Index of the converged start with the lowest cost, -1 if none converged
+    int best() const
+    {
+        int iBest = -1;
+        for (unsigned int i=0;i<m_costs.size();i++)
+        {
+            if (!m_errors[i].empty()) continue;
+            if (iBest < 0 || m_costs[i] < m_costs[iBest]) iBest = i;
+        }
+        return iBest;
+    }
+    const std::vector<double> & solution(int i) const { return m_solutions[i]; }
+    const std::string & error(int i) const { return m_errors[i]; }
+
+private:
+    const Settings & m_settings;
+    FGTrimmer::Constraints & m_constraints;
+    FGFDMExec * m_fdm;
+    const std::vector<FGFDMExec*> & m_clones;
+    const std::vector< std::vector<double> > & m_guesses;
+    std::vector< std::vector<double> > m_solutions;
+    std::vector<double> m_costs;
+    std::vector<std::string> m_errors;
+};
+
+}
+
 FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
 {
     std::clock_t time_start=clock(), time_trimDone;
@@ -61,7 +156,14 @@ FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
 
     // initial solver state
     int n = 6;
-    std::vector<double> initialGuess(n), lowerBound(n), upperBound(n), initialStepSize(n);
+    SimplexStarts::Settings settings;
+    std::vector<double> initialGuess(n);
+    std::vector<double> & lowerBound = settings.lowerBound;
+    std::vector<double> & upperBound = settings.upperBound;
+    std::vector<double> & initialStepSize = settings.initialStepSize;
+    lowerBound.resize(n);
+    upperBound.resize(n);
+    initialStepSize.resize(n);
 
     lowerBound[0] = node->GetDouble("trim/solver/throttleMin");
     lowerBound[1] = node->GetDouble("trim/solver/elevatorMin");
@@ -91,26 +193,82 @@ FGSimplexTrim::FGSimplexTrim(FGFDMExec * fdm, TrimMode mode)
     initialGuess[4] = node->GetDouble("trim/solver/rudderGuess");
     initialGuess[5] = node->GetDouble("trim/solver/betaGuess");
 
-    // solve
-    FGTrimmer * trimmer = new FGTrimmer(fdm, &constraints);
-    Callback callback(aircraftName, trimmer);
-    FGNelderMead * solver = NULL;
+    settings.iterMax = iterMax;
+    settings.rtol = rtol;
+    settings.abstol = abstol;
+    settings.speed = speed;
+    settings.random = random;
+    settings.showConvergence = showConvergence;
+    settings.showSimplex = showSimplex;
+    settings.pause = pause;
+    settings.seed = node->GetInt("trim/solver/seed");
+    settings.logName = aircraftName;
+
+    // restarts: the first one starts from the initial guess, the others from
+    // points scattered within one step size of it
+    int starts = node->GetInt("trim/solver/starts");
+    if (starts < 1) starts = 1;
+    unsigned int nThreads = node->GetInt("trim/solver/threads");
+    if (nThreads == 0) nThreads = FGThreadPool::GetHardwareConcurrency();
+    if (nThreads > (unsigned int)starts) nThreads = starts;
+
+    std::vector< std::vector<double> > guesses(starts, initialGuess);
+    // stream 0 scatters the guesses, stream start+1 randomizes the search
+    // of each start
+    FGRandom scatter(settings.seed);
+    for (int start=1;start<starts;start++)
+    {
+        for (int i=0;i<n;i++)
+        {
+            double & x = guesses[start][i];
+            x += initialStepSize[i]*scatter.GetUniformSigned();
+            if (x > upperBound[i]) x = upperBound[i];
+            else if (x < lowerBound[i]) x = lowerBound[i];
+        }
+    }
+
+    // solve, a single search runs on the FDM itself and several ones on one
+    // clone per thread
+    std::vector< std::unique_ptr<FGFDMExec> > clones;
+    std::vector<FGFDMExec*> workers;
+    if (starts > 1)
+    {
+        for (unsigned int i=0;i<nThreads;i++)
+        {
+            clones.push_back(std::unique_ptr<FGFDMExec>(fdm->Clone()));
+            if (!clones.back()) throw std::runtime_error("unable to clone the FDM");
+            workers.push_back(clones.back().get());
+        }
+    }
 
-    solver = new FGNelderMead(trimmer,initialGuess,
-        lowerBound, upperBound, initialStepSize,iterMax,rtol,
-        abstol,speed,random,showConvergence,showSimplex,pause,&callback);
-    while(solver->status()==1) solver->update();
+    SimplexStarts job(settings, constraints, fdm, workers, guesses);
+    if (nThreads > 1)
+    {
+        FGThreadPool pool(nThreads);
+        pool.Run(job, starts);
+    }
+    else
+    {
+        for (int start=0;start<starts;start++) job.Execute(start, 0);
+    }
+    clones.clear();
     time_trimDone = std::clock();
 
+    int best = job.best();
+    if (best < 0) throw std::runtime_error(job.error(0));
+    std::vector<double> solution = job.solution(best);
+
+    // leave the FDM in the trimmed state
+    FGTrimmer trimmer(fdm, &constraints);
+    double cost = trimmer.eval(solution);
+
     // output
     if (fdm->GetDebugLevel() > 0) {
-        trimmer->printSolution(std::cout,solver->getSolution());
-        std::cout << "\nfinal cost: " << std::scientific << std::setw(10) << trimmer->eval(solver->getSolution()) << std::endl;
+        if (starts > 1) std::cout << "best of " << starts << " starts: " << best << std::endl;
+        trimmer.printSolution(std::cout,solution);
+        std::cout << "\nfinal cost: " << std::scientific << std::setw(10) << cost << std::endl;
         std::cout << "\ntrim computation time: " << (time_trimDone - time_start)/double(CLOCKS_PER_SEC) << "s \n" << std::endl;
     }
-
-    delete solver;
-    delete trimmer;
 }
 
 } // JSBSim
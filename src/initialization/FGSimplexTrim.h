@@ -37,19 +37,16 @@ namespace JSBSim {
 class FGSimplexTrim
 {
 public:
+    /** Trims the aircraft by minimizing the FGTrimmer cost with the simplex
+        algorithm. The solver is configured through the trim/solver/*
+        properties. When trim/solver/starts is greater than 1, that many
+        independent searches are run from initial guesses scattered around
+        trim/solver/*Guess on trim/solver/threads threads (0 for one per
+        processor), and the solution with the lowest cost is kept. The FDM is
+        cloned once per thread and each search starts by copying the state of
+        the FDM to the clone it runs on, so the searches are reproducible for
+        a given trim/solver/seed whatever the number of threads. */
     FGSimplexTrim(FGFDMExec * fdmPtr, TrimMode mode);
-private:
-    template <class varType>
-    void prompt(const std::string & str, varType & var)
-    {
-        std::cout << str + " [" << std::setw(10) << var << "]\t: ";
-        if (std::cin.peek() != '\n')
-        {
-            std::cin >> var;
-            std::cin.ignore(1000, '\n');
-        }
-        else std::cin.get();
-    }
 
     class Callback : public JSBSim::FGNelderMead::Callback
     {   
@@ -72,6 +69,19 @@ private:
             //std::cout << std::endl;
         }
     };
+
+private:
+    template <class varType>
+    void prompt(const std::string & str, varType & var)
+    {
+        std::cout << str + " [" << std::setw(10) << var << "]\t: ";
+        if (std::cin.peek() != '\n')
+        {
+            std::cin >> var;
+            std::cin.ignore(1000, '\n');
+        }
+        else std::cin.get();
+    }
 };
 
 } // JSBSim
@@ -33,7 +33,7 @@ FUNCTIONAL DESCRIPTION
 This class takes the given set of IC's and finds the angle of attack, elevator,
 and throttle setting required to fly steady level. This is currently for in-air
 conditions only.  It is implemented using an iterative, one-axis-at-a-time
-scheme. */
+scheme or a simultaneous Levenberg-Marquardt solve of all the axes. */
 
 //  !!!!!!! BEWARE ALL YE WHO ENTER HERE !!!!!!!
 
@@ -81,6 +81,9 @@ FGTrim::FGTrim(FGFDMExec *FDMExec,TrimMode tt)
   xlo=xhi=alo=ahi=0.0;
   targetNlf=1.0;
   debug_axis=tAll;
+  solver=tAxisByAxis;
+  solver_runs=0;
+  residual=0.0;
   SetMode(tt);
   if (debug_lvl & 2) cout << "Instantiated: FGTrim" << endl;
 }
@@ -110,6 +113,30 @@ void FGTrim::TrimStats() {
     }
     cout << "    Run Count: " << run_sum << endl;
   }
+  if (solver == tSimultaneous) {
+    cout << "    Simultaneous solver runs: " << solver_runs << endl;
+    cout << "    Residual: " << setprecision(5) << residual << endl;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGTrim::GetRunCount(void)
+{
+  unsigned int run_sum = solver_runs;
+  for (unsigned int current_axis=0; current_axis<TrimAxes.size(); current_axis++)
+    run_sum += TrimAxes[current_axis].GetRunCount();
+  return run_sum;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<double> FGTrim::GetControls(void)
+{
+  vector<double> controls(TrimAxes.size());
+  for (unsigned int current_axis=0; current_axis<TrimAxes.size(); current_axis++)
+    controls[current_axis] = TrimAxes[current_axis].GetControl();
+  return controls;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -198,6 +225,10 @@ bool FGTrim::DoTrim(void) {
   double rudder0 = FCS->GetDrCmd();
   double PitchTrim0 = FCS->GetPitchTrimCmd();
 
+  // The run count only covers this call
+  solver_runs = 0;
+  for (unsigned int i=0; i<TrimAxes.size(); i++) TrimAxes[i].ResetRunCount();
+
   for(int i=0;i < fdmex->GetGroundReactions()->GetNumGearUnits();i++)
     fdmex->GetGroundReactions()->GetGearUnit(i)->SetReport(false);
 
@@ -227,7 +258,10 @@ bool FGTrim::DoTrim(void) {
     //<< "  " << TrimAxes[current_axis]->GetControlName()<< endl;
     xlo=TrimAxes[current_axis].GetControlMin();
     xhi=TrimAxes[current_axis].GetControlMax();
-    TrimAxes[current_axis].SetControl((xlo+xhi)/2);
+    if (initial_guess.size() == TrimAxes.size())
+      TrimAxes[current_axis].SetControl(min(max(initial_guess[current_axis], xlo), xhi));
+    else
+      TrimAxes[current_axis].SetControl((xlo+xhi)/2);
     TrimAxes[current_axis].Run();
     //TrimAxes[current_axis].AxisReport();
     sub_iterations[current_axis]=0;
@@ -246,71 +280,86 @@ bool FGTrim::DoTrim(void) {
     //TrimAxes[0].SetStateTarget(targetNlf);
   }
 
-  do {
-    axis_count=0;
-    for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
-      setDebug(TrimAxes[current_axis]);
-      updateRates();
-      Nsub=0;
-      if(!solution[current_axis]) {
-        if(checkLimits(TrimAxes[current_axis])) {
-          solution[current_axis]=true;
+  bool solved = false;
+  if (solver == tSimultaneous) {
+    solved = solveSimultaneous();
+    N = total_its;
+    if (solved)
+      axis_count = TrimAxes.size();
+    else if (debug_lvl > 0)
+      cout << "  Simultaneous trim failed, trying axis by axis" << endl;
+  }
+
+  if (!solved) {
+    N = 0;
+    do {
+      axis_count=0;
+      for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
+        setDebug(TrimAxes[current_axis]);
+        updateRates();
+        Nsub=0;
+        if(!solution[current_axis]) {
+          if(checkLimits(TrimAxes[current_axis])) {
+            solution[current_axis]=true;
+            solve(TrimAxes[current_axis]);
+          }
+        } else if(findInterval(TrimAxes[current_axis])) {
           solve(TrimAxes[current_axis]);
+        } else {
+          solution[current_axis]=false;
         }
-      } else if(findInterval(TrimAxes[current_axis])) {
-        solve(TrimAxes[current_axis]);
-      } else {
-        solution[current_axis]=false;
+        sub_iterations[current_axis]+=Nsub;
       }
-      sub_iterations[current_axis]+=Nsub;
-    }
-    for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
-      //these checks need to be done after all the axes have run
-      if(Debug > 0) TrimAxes[current_axis].AxisReport();
-      if(TrimAxes[current_axis].InTolerance()) {
-        axis_count++;
-        successful[current_axis]++;
+      for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
+        //these checks need to be done after all the axes have run
+        if(Debug > 0) TrimAxes[current_axis].AxisReport();
+        if(TrimAxes[current_axis].InTolerance()) {
+          axis_count++;
+          successful[current_axis]++;
+        }
       }
-    }
 
-    if((axis_count == TrimAxes.size()-1) && (TrimAxes.size() > 1)) {
-      //cout << TrimAxes.size()-1 << " out of " << TrimAxes.size() << "!" << endl;
-      //At this point we can check the input limits of the failed axis
-      //and declare the trim failed if there is no sign change. If there
-      //is, keep going until success or max iteration count
+      if((axis_count == TrimAxes.size()-1) && (TrimAxes.size() > 1)) {
+        //cout << TrimAxes.size()-1 << " out of " << TrimAxes.size() << "!" << endl;
+        //At this point we can check the input limits of the failed axis
+        //and declare the trim failed if there is no sign change. If there
+        //is, keep going until success or max iteration count
+
+        //Oh, well: two out of three ain't bad
+        for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
+          //these checks need to be done after all the axes have run
+          if(!TrimAxes[current_axis].InTolerance()) {
+            if(!checkLimits(TrimAxes[current_axis])) {
+              // special case this for now -- if other cases arise proper
+              // support can be added to FGTrimAxis
+              if( (gamma_fallback) &&
+                  (TrimAxes[current_axis].GetStateType() == tUdot) &&
+                  (TrimAxes[current_axis].GetControlType() == tThrottle)) {
+                cout << "  Can't trim udot with throttle, trying flight"
+                << " path angle. (" << N << ")" << endl;
+                if(TrimAxes[current_axis].GetState() > 0)
+                  TrimAxes[current_axis].SetControlToMin();
+                else
+                  TrimAxes[current_axis].SetControlToMax();
+                TrimAxes[current_axis].Run();
+                TrimAxes[current_axis]=FGTrimAxis(fdmex,&fgic,tUdot,tGamma);
+              } else {
+                cout << "  Sorry, " << TrimAxes[current_axis].GetStateName()
+                << " doesn't appear to be trimmable" << endl;
+                //total_its=k;
+                trim_failed=true; //force the trim to fail
+              } //gamma_fallback
+            }
+          } //solution check
+        } //for loop
+      } //all-but-one check
+      N++;
+      if(N > max_iterations)
+        trim_failed=true;
+    } while((axis_count < TrimAxes.size()) && (!trim_failed));
+  }
 
-      //Oh, well: two out of three ain't bad
-      for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
-        //these checks need to be done after all the axes have run
-        if(!TrimAxes[current_axis].InTolerance()) {
-          if(!checkLimits(TrimAxes[current_axis])) {
-            // special case this for now -- if other cases arise proper
-            // support can be added to FGTrimAxis
-            if( (gamma_fallback) &&
-                (TrimAxes[current_axis].GetStateType() == tUdot) &&
-                (TrimAxes[current_axis].GetControlType() == tThrottle)) {
-              cout << "  Can't trim udot with throttle, trying flight"
-              << " path angle. (" << N << ")" << endl;
-              if(TrimAxes[current_axis].GetState() > 0)
-                TrimAxes[current_axis].SetControlToMin();
-              else
-                TrimAxes[current_axis].SetControlToMax();
-              TrimAxes[current_axis].Run();
-              TrimAxes[current_axis]=FGTrimAxis(fdmex,&fgic,tUdot,tGamma);
-            } else {
-              cout << "  Sorry, " << TrimAxes[current_axis].GetStateName()
-              << " doesn't appear to be trimmable" << endl;
-              //total_its=k;
-              trim_failed=true; //force the trim to fail
-            } //gamma_fallback
-          }
-        } //solution check
-      } //for loop
-    } //all-but-one check
-    N++;
-    if(N > max_iterations)
-      trim_failed=true;
-  } while((axis_count < TrimAxes.size()) && (!trim_failed));
+  residual = computeResidual();
 
   if((!trim_failed) && (axis_count >= TrimAxes.size())) {
     total_its=N;
@@ -598,6 +647,192 @@ bool FGTrim::solve(FGTrimAxis& axis) {
   return success;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Solves the n x n linear system stored in the augmented matrix M (the right
+// hand side is the last column) by Gaussian elimination with partial pivoting.
+// Returns false if the matrix is singular.
+
+static bool solveLinearSystem(vector< vector<double> >& M, vector<double>& x)
+{
+  unsigned int n = M.size();
+
+  for (unsigned int k=0; k<n; k++) {
+    unsigned int pivot = k;
+    for (unsigned int i=k+1; i<n; i++)
+      if (fabs(M[i][k]) > fabs(M[pivot][k])) pivot = i;
+    if (fabs(M[pivot][k]) < 1E-300) return false;
+    swap(M[k], M[pivot]);
+    for (unsigned int i=k+1; i<n; i++) {
+      double c = M[i][k] / M[k][k];
+      for (unsigned int j=k; j<=n; j++) M[i][j] -= c*M[k][j];
+    }
+  }
+
+  x.resize(n);
+  for (int i=n-1; i>=0; i--) {
+    double sum = M[i][n];
+    for (unsigned int j=i+1; j<n; j++) sum -= M[i][j]*x[j];
+    x[i] = sum / M[i][i];
+  }
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrim::evaluate(const vector<double>& x, vector<double>& f)
+{
+  unsigned int n = TrimAxes.size();
+
+  for (unsigned int i=0; i<n; i++) {
+    double xmin = TrimAxes[i].GetControlMin();
+    double xmax = TrimAxes[i].GetControlMax();
+    TrimAxes[i].SetControl(xmin + x[i]*(xmax-xmin));
+    TrimAxes[i].ApplyControl();
+  }
+  updateRates();
+
+  // Same stability criterion than FGTrimAxis::Run() but applied to all the
+  // axes at once.
+  f.resize(n);
+  for (int k=0; k<100; k++) {
+    bool stable = k > 0;
+    fdmex->Initialize(&fgic);
+    fdmex->Run();
+    solver_runs++;
+    for (unsigned int i=0; i<n; i++) {
+      double fi = TrimAxes[i].GetState() / TrimAxes[i].GetTolerance();
+      if (fabs(fi - f[i]) >= 1.0) stable = false;
+      f[i] = fi;
+    }
+    if (stable) break;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTrim::computeResidual(void)
+{
+  double r = 0.0;
+  for (unsigned int i=0; i<TrimAxes.size(); i++)
+    r = max(r, fabs(TrimAxes[i].GetState()) / TrimAxes[i].GetTolerance());
+  return r;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The controls are normalized to [0,1] over their limits and the states are
+// scaled by their tolerances so that the trim is achieved when all the scaled
+// states are within [-1,1]. The Levenberg-Marquardt step is computed from the
+// normal equations (J^T J + lambda diag(J^T J)) dx = -J^T f and projected on
+// the control limits. The Jacobian J is updated after each step with Broyden's
+// formula J += (df - J dx) dx^T / (dx^T dx) and recomputed by finite
+// differences only when three steps in a row failed to reduce the residual.
+
+bool FGTrim::solveSimultaneous(void)
+{
+  const unsigned int n = TrimAxes.size();
+  const double h = 1E-3;
+  vector<double> x(n), f(n), xnew(n), fnew(n), dx(n);
+  vector< vector<double> > J(n, vector<double>(n));
+  bool updateJacobian = true;
+  unsigned int rejected = 0;
+  double lambda = 1E-3;
+
+  total_its = 0;
+  if (n == 0) return true;
+
+  for (unsigned int i=0; i<n; i++) {
+    double xmin = TrimAxes[i].GetControlMin();
+    double xmax = TrimAxes[i].GetControlMax();
+    x[i] = (TrimAxes[i].GetControl() - xmin) / (xmax - xmin);
+  }
+  evaluate(x, f);
+
+  double cost = 0.0, fmax = 0.0;
+  for (unsigned int i=0; i<n; i++) {
+    cost += f[i]*f[i];
+    fmax = max(fmax, fabs(f[i]));
+  }
+
+  while (fmax > 1.0) {
+    if (total_its >= max_iterations) {
+      // The last evaluation may have been a rejected step: the controls and
+      // the FDM are reset to the best point found so that the axis by axis
+      // fallback restarts from there.
+      evaluate(x, f);
+      return false;
+    }
+    total_its++;
+
+    if (updateJacobian) {
+      for (unsigned int j=0; j<n; j++) {
+        double step = x[j] + h <= 1.0 ? h : -h;
+        xnew = x;
+        xnew[j] += step;
+        evaluate(xnew, fnew);
+        for (unsigned int i=0; i<n; i++) J[i][j] = (fnew[i] - f[i]) / step;
+      }
+      updateJacobian = false;
+      rejected = 0;
+    }
+
+    vector< vector<double> > M(n, vector<double>(n+1, 0.0));
+    for (unsigned int i=0; i<n; i++) {
+      for (unsigned int k=0; k<n; k++)
+        for (unsigned int l=0; l<n; l++) M[i][k] += J[l][i]*J[l][k];
+      for (unsigned int l=0; l<n; l++) M[i][n] -= J[l][i]*f[l];
+      M[i][i] += lambda*M[i][i] + 1E-12;
+    }
+
+    if (!solveLinearSystem(M, dx)) {
+      updateJacobian = true;
+      continue;
+    }
+
+    double dx2 = 0.0;
+    for (unsigned int i=0; i<n; i++) {
+      xnew[i] = min(max(x[i] + dx[i], 0.0), 1.0);
+      dx[i] = xnew[i] - x[i];
+      dx2 += dx[i]*dx[i];
+    }
+
+    evaluate(xnew, fnew);
+
+    if (dx2 > 0.0) {
+      for (unsigned int i=0; i<n; i++) {
+        double r = fnew[i] - f[i];
+        for (unsigned int j=0; j<n; j++) r -= J[i][j]*dx[j];
+        for (unsigned int j=0; j<n; j++) J[i][j] += r*dx[j]/dx2;
+      }
+    }
+
+    double newcost = 0.0, newmax = 0.0;
+    for (unsigned int i=0; i<n; i++) {
+      newcost += fnew[i]*fnew[i];
+      newmax = max(newmax, fabs(fnew[i]));
+    }
+
+    if (DebugLevel > 0)
+      cout << "FGTrim::solveSimultaneous it: " << total_its << " lambda: "
+           << lambda << " residual: " << fmax << " -> " << newmax << endl;
+
+    if (newcost < cost) {
+      x = xnew;
+      f = fnew;
+      cost = newcost;
+      fmax = newmax;
+      lambda = max(lambda/3.0, 1E-9);
+      rejected = 0;
+    } else {
+      lambda *= 4.0;
+      if (++rejected > 2) updateJacobian = true;
+    }
+  }
+
+  // The last evaluation was made for the solution (either the initial guess
+  // or the last accepted step) so the FDM is left in the trimmed state.
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 /*
  produces an interval (xlo..xhi) on one side or the other of the current
@@ -37,7 +37,8 @@ maintain a specified flight condition.  This flight condition can be
 steady-level with non-zero sideslip, a steady turn, a pull-up or pushover.
 On-ground conditions can be trimmed as well, but this is currently limited to
 adjusting altitude and pitch angle only. It is implemented using an iterative,
-one-axis-at-a-time scheme.
+one-axis-at-a-time scheme or, optionally, a simultaneous Levenberg-Marquardt
+solve of all the axes.
 
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 SENTRY
@@ -73,6 +74,8 @@ namespace JSBSim {
 typedef enum { tLongitudinal=0, tFull, tGround, tPullup,
                tCustom, tTurn, tNone } TrimMode;
 
+typedef enum { tAxisByAxis=0, tSimultaneous } TrimSolver;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -100,6 +103,22 @@ CLASS DOCUMENTATION
     The remaining modes include <b>tCustom</b>, which is completely user defined and
     <b>tNone</b>.
 
+    Two solvers are available and can be selected with SetSolver():
+    - tAxisByAxis (default): each control is adjusted in turn with a bracketing
+      secant search until its own state is within tolerance, and the cycle is
+      repeated until all the axes are trimmed.
+    - tSimultaneous: all the controls are adjusted at once by a damped Newton
+      (Levenberg-Marquardt) iteration. The Jacobian of the states with respect
+      to the controls is computed once by finite differences and then updated
+      with Broyden's rank-one formula from the steps already taken; it is only
+      recomputed when the damped steps stop reducing the residual. This
+      usually needs far fewer FDM runs than tAxisByAxis. If it fails to
+      converge (typically for the stiff, non smooth on-ground trims) DoTrim()
+      falls back to tAxisByAxis from where it stopped.
+
+    The convergence statistics of the last trim are available through
+    GetIterations(), GetRunCount() and GetResidual().
+
     Note that trims can (and do) fail for reasons that are completely outside
     the control of the trimming routine itself. The most common problem is the
     initial conditions: is the model capable of steady state flight
@@ -151,11 +170,29 @@ private:
 
   double psidot;
 
+  TrimSolver solver;
+  unsigned int solver_runs;
+  double residual;
+  std::vector<double> initial_guess;
+
   FGFDMExec* fdmex;
   FGInitialCondition fgic;
 
   bool solve(FGTrimAxis& axis);
 
+  /** Solves all the axes simultaneously with a Levenberg-Marquardt iteration
+      using a Broyden updated Jacobian.
+      @return true if all the axes are within tolerance */
+  bool solveSimultaneous(void);
+
+  /** Sets the controls from their normalized values (0 at the control min, 1
+      at the control max), runs the FDM until the states are stable and
+      returns the states scaled by their tolerances. */
+  void evaluate(const std::vector<double>& x, std::vector<double>& f);
+
+  /// Largest state to tolerance ratio over all the axes.
+  double computeResidual(void);
+
   /** @return false if there is no change in the current axis accel
       between accel(control_min) and accel(control_max). If there is a
       change, sets solutionDomain to:
@@ -212,6 +249,35 @@ public:
   */
   void TrimStats();
 
+  /** Select the algorithm used by DoTrim().
+      @param ts tAxisByAxis or tSimultaneous */
+  inline void SetSolver(TrimSolver ts) { solver = ts; }
+  inline TrimSolver GetSolver(void) const { return solver; }
+
+  /// Number of top level iterations performed by the last call to DoTrim().
+  inline unsigned int GetIterations(void) const { return total_its; }
+
+  /// Number of FDM runs performed by the last call to DoTrim().
+  unsigned int GetRunCount(void);
+
+  /** Largest ratio of a state to its tolerance after the last call to
+      DoTrim(). The trim is successful when it does not exceed 1. */
+  inline double GetResidual(void) const { return residual; }
+
+  /** Set the values from which the controls start at the next call to
+      DoTrim(), one per state-control pair in the order they were added (for
+      instance the controls of a previous trim at a nearby flight condition).
+      By default the controls start from the middle of their limits.
+      @param controls initial controls, or an empty vector for the default */
+  inline void SetInitialGuess(const std::vector<double>& controls) { initial_guess = controls; }
+
+  /// Returns the current value of the controls, one per state-control pair.
+  std::vector<double> GetControls(void);
+
+  /** Returns the initial conditions modified by the trim (angle of attack,
+      attitude, altitude, ...). */
+  inline const FGInitialCondition& GetTrimIC(void) const { return fgic; }
+
   /** Clear all state-control pairs and set a predefined trim mode
       @param tm the set of axes to trim. Can be:
              tLongitudinal, tFull, tGround, tCustom, or tNone
@@ -112,6 +112,10 @@ public:
   inline void SetControl(double value ) { control_value=value; }
   inline double GetControl(void) { return control_value; }
 
+  /** Applies the current control value to the initial conditions or to the
+      flight controls without waiting for the state to settle. */
+  inline void ApplyControl(void) { setControl(); }
+
   inline State GetStateType(void) { return state; }
   inline Control GetControlType(void) { return control; }
 
@@ -140,6 +144,7 @@ public:
 
   inline int GetStability(void) { return its_to_stable_value; }
   inline int GetRunCount(void) { return total_stability_iterations; }
+  inline void ResetRunCount(void) { total_iterations = total_stability_iterations = 0; }
   double GetAvgStability( void );
   
   inline void SetStateTarget(double target) { state_target=target; }
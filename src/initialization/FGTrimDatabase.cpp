@@ -0,0 +1,350 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTrimDatabase.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Trim results over a grid of flight conditions
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+#include "FGTrimDatabase.h"
+#include "input_output/FGXMLFileRead.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGTrimDatabase.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_TRIMDATABASE);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGTrimDatabase::FGTrimDatabase(void)
+{
+  Debug(0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrimDatabase::~FGTrimDatabase(void)
+{
+  Debug(1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimDatabase::AddDimension(const string& property,
+                                  const vector<double>& breakpoints)
+{
+  if (breakpoints.empty())
+    throw string("FGTrimDatabase: dimension " + property + " has no breakpoints");
+
+  for (unsigned int i=1; i<breakpoints.size(); i++) {
+    if (breakpoints[i] <= breakpoints[i-1])
+      throw string("FGTrimDatabase: the breakpoints of " + property
+                   + " are not in ascending order");
+  }
+
+  Dimensions.push_back(property);
+  Breakpoints.push_back(breakpoints);
+  Resize();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimDatabase::AddOutput(const string& property)
+{
+  Outputs.push_back(property);
+  Resize();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimDatabase::Clear(void)
+{
+  Dimensions.clear();
+  Breakpoints.clear();
+  Outputs.clear();
+  Trimmed.clear();
+  Values.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimDatabase::Resize(void)
+{
+  unsigned int n = 1;
+  for (unsigned int i=0; i<Breakpoints.size(); i++)
+    n *= Breakpoints[i].size();
+  if (Breakpoints.empty()) n = 0;
+
+  Trimmed.assign(n, 0);
+  Values.assign(n*Outputs.size(), 0.0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimDatabase::GetIndices(unsigned int point,
+                                vector<unsigned int>& indices) const
+{
+  indices.resize(Dimensions.size());
+  for (int i=Dimensions.size()-1; i>=0; i--) {
+    unsigned int n = Breakpoints[i].size();
+    indices[i] = point % n;
+    point /= n;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGTrimDatabase::GetPoint(const vector<unsigned int>& indices) const
+{
+  unsigned int point = 0;
+  for (unsigned int i=0; i<Dimensions.size(); i++)
+    point = point*Breakpoints[i].size() + indices[i];
+  return point;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimDatabase::GetKeys(unsigned int point, vector<double>& keys) const
+{
+  vector<unsigned int> indices;
+  GetIndices(point, indices);
+  keys.resize(Dimensions.size());
+  for (unsigned int i=0; i<Dimensions.size(); i++)
+    keys[i] = Breakpoints[i][indices[i]];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimDatabase::SetPoint(unsigned int point, bool trimmed,
+                              const vector<double>& outputs)
+{
+  Trimmed[point] = trimmed ? 1 : 0;
+  if (!trimmed) return;
+
+  for (unsigned int j=0; j<Outputs.size(); j++)
+    Values[point*Outputs.size()+j] = outputs[j];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimDatabase::Interpolate(const vector<double>& keys,
+                                 vector<double>& outputs) const
+{
+  unsigned int nDim = Dimensions.size();
+  unsigned int nOut = Outputs.size();
+  vector<unsigned int> lower(nDim), indices(nDim);
+  vector<double> factor(nDim);
+
+  outputs.assign(nOut, 0.0);
+  if (Trimmed.empty()) return false;
+
+  // Locate the cell that contains the flight condition
+  for (unsigned int i=0; i<nDim; i++) {
+    const vector<double>& bp = Breakpoints[i];
+    if (bp.size() == 1 || keys[i] <= bp.front()) {
+      lower[i] = 0;
+      factor[i] = 0.0;
+    } else if (keys[i] >= bp.back()) {
+      lower[i] = bp.size() - 2;
+      factor[i] = 1.0;
+    } else {
+      lower[i] = upper_bound(bp.begin(), bp.end(), keys[i]) - bp.begin() - 1;
+      factor[i] = (keys[i] - bp[lower[i]]) / (bp[lower[i]+1] - bp[lower[i]]);
+    }
+  }
+
+  // Weighted sum over the 2^n corners of the cell
+  double total = 0.0;
+  for (unsigned int corner=0; corner < (1u << nDim); corner++) {
+    double weight = 1.0;
+    for (unsigned int i=0; i<nDim; i++) {
+      bool up = (corner >> i) & 1;
+      if (up && Breakpoints[i].size() == 1) { weight = 0.0; break; }
+      indices[i] = lower[i] + (up ? 1 : 0);
+      weight *= up ? factor[i] : 1.0 - factor[i];
+    }
+    if (weight == 0.0) continue;
+
+    unsigned int point = GetPoint(indices);
+    if (!Trimmed[point]) continue;
+
+    total += weight;
+    for (unsigned int j=0; j<nOut; j++)
+      outputs[j] += weight * Values[point*nOut+j];
+  }
+
+  if (total == 0.0) return false;
+
+  for (unsigned int j=0; j<nOut; j++) outputs[j] /= total;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimDatabase::Save(const SGPath& filename) const
+{
+  sg_ofstream outfile(filename);
+
+  if (!outfile.is_open()) {
+    cerr << "Could not open the trim database file: " << filename << endl;
+    return false;
+  }
+
+  outfile << "<?xml version=\"1.0\"?>" << endl;
+  outfile << "<trim_database>" << endl;
+  outfile << setprecision(10);
+  for (unsigned int i=0; i<Dimensions.size(); i++) {
+    outfile << "  <dimension property=\"" << Dimensions[i] << "\">";
+    for (unsigned int k=0; k<Breakpoints[i].size(); k++)
+      outfile << " " << Breakpoints[i][k];
+    outfile << " </dimension>" << endl;
+  }
+  for (unsigned int j=0; j<Outputs.size(); j++)
+    outfile << "  <output property=\"" << Outputs[j] << "\"/>" << endl;
+  for (unsigned int p=0; p<Trimmed.size(); p++) {
+    outfile << "  <point trimmed=\"" << (Trimmed[p] ? 1 : 0) << "\">";
+    for (unsigned int j=0; j<Outputs.size(); j++)
+      outfile << " " << Values[p*Outputs.size()+j];
+    outfile << " </point>" << endl;
+  }
+  outfile << "</trim_database>" << endl;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static vector<double> ReadNumbers(Element* el)
+{
+  vector<double> values;
+  for (unsigned int i=0; i<el->GetNumDataLines(); i++) {
+    istringstream line(el->GetDataLine(i));
+    double value;
+    while (line >> value) values.push_back(value);
+  }
+  return values;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimDatabase::Load(const SGPath& filename)
+{
+  FGXMLFileRead XMLFileRead;
+  Element* document = XMLFileRead.LoadXMLDocument(filename);
+
+  if (!document || document->GetName() != string("trim_database")) {
+    cerr << "File: " << filename << " is not a trim database." << endl;
+    return false;
+  }
+
+  Clear();
+
+  Element* el = document->FindElement("dimension");
+  while (el) {
+    try {
+      AddDimension(el->GetAttributeValue("property"), ReadNumbers(el));
+    } catch (const string& msg) {
+      cerr << el->ReadFrom() << msg << endl;
+      return false;
+    }
+    el = document->FindNextElement("dimension");
+  }
+
+  el = document->FindElement("output");
+  while (el) {
+    AddOutput(el->GetAttributeValue("property"));
+    el = document->FindNextElement("output");
+  }
+
+  unsigned int point = 0;
+  el = document->FindElement("point");
+  while (el && point < Trimmed.size()) {
+    vector<double> values = ReadNumbers(el);
+    bool trimmed = el->GetAttributeValueAsNumber("trimmed") != 0.0;
+    if (trimmed && values.size() != Outputs.size()) {
+      cerr << el->ReadFrom() << "Wrong number of outputs in trim database point "
+           << point << endl;
+      return false;
+    }
+    SetPoint(point++, trimmed, values);
+    el = document->FindNextElement("point");
+  }
+
+  if (point != Trimmed.size()) {
+    cerr << "File: " << filename << " does not contain all the points of the grid."
+         << endl;
+    return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//    The bitmasked value choices are as follows:
+//    unset: In this case (the default) JSBSim would only print
+//       out the normally expected messages, essentially echoing
+//       the config files as they are read. If the environment
+//       variable is not set, debug_lvl is set to 1 internally
+//    0: This requests JSBSim not to output any messages
+//       whatsoever.
+//    1: This value explicity requests the normal JSBSim
+//       startup messages
+//    2: This value asks for a message to be printed out when
+//       a class is instantiated
+//    4: When this value is set, a message is displayed when a
+//       FGModel object executes its Run() method
+//    8: When this value is set, various runtime state variables
+//       are printed out periodically
+//    16: When set various parameters are sanity checked and
+//       a message is printed out when they go out of bounds
+
+void FGTrimDatabase::Debug(int from)
+{
+  if (debug_lvl <= 0) return;
+
+  if (debug_lvl & 2 ) { // Instantiation/Destruction notification
+    if (from == 0) cout << "Instantiated: FGTrimDatabase" << endl;
+    if (from == 1) cout << "Destroyed:    FGTrimDatabase" << endl;
+  }
+  if (debug_lvl & 64) {
+    if (from == 0) { // Constructor
+      cout << IdSrc << endl;
+      cout << IdHdr << endl;
+    }
+  }
+}
+}
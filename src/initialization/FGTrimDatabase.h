@@ -0,0 +1,171 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTrimDatabase.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTRIMDATABASE_H
+#define FGTRIMDATABASE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "simgear/misc/sg_path.hxx"
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_TRIMDATABASE "$Id: FGTrimDatabase.h,v 1.0 2026/10/18 Outerra Exp $"
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Stores trim results over a rectangular grid of flight conditions.
+
+    Each dimension of the grid is a property (for instance ic/h-sl-ft,
+    ic/vc-kts, inertia/pointmass-weight-lbs[1] or fcs/flap-cmd-norm) with an
+    ascending list of breakpoints. For each point of the grid, the database
+    records whether the trim succeeded and the values of a list of output
+    properties (for instance ic/alpha-deg or fcs/throttle-cmd-norm[0]).
+
+    Points are numbered in row major order: the last dimension varies
+    fastest.
+
+    The database is normally filled by FGTrimSweep and used by
+    FGInitialCondition::SetFromTrimDatabase(). It can be saved to and loaded
+    from an XML file:
+
+    @code
+    <trim_database>
+      <dimension property="ic/h-sl-ft"> 1000 5000 10000 </dimension>
+      <dimension property="ic/vc-kts"> 80 100 120 </dimension>
+      <output property="ic/alpha-deg"/>
+      <output property="fcs/throttle-cmd-norm[0]"/>
+      <point trimmed="1"> 4.27 0.48 </point>
+      ...
+    </trim_database>
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTrimDatabase : public FGJSBBase
+{
+public:
+  FGTrimDatabase(void);
+  ~FGTrimDatabase(void);
+
+  /** Adds a dimension to the grid. All the points are reset.
+      @param property name of the property swept along this dimension
+      @param breakpoints ascending values of the property */
+  void AddDimension(const std::string& property,
+                    const std::vector<double>& breakpoints);
+
+  /** Adds an output. All the points are reset.
+      @param property name of the property recorded at each point */
+  void AddOutput(const std::string& property);
+
+  /// Removes all the dimensions, outputs and points.
+  void Clear(void);
+
+  unsigned int GetNumDimensions(void) const { return (unsigned int)Dimensions.size(); }
+  const std::string& GetDimensionName(unsigned int i) const { return Dimensions[i]; }
+  const std::vector<double>& GetBreakpoints(unsigned int i) const { return Breakpoints[i]; }
+
+  unsigned int GetNumOutputs(void) const { return (unsigned int)Outputs.size(); }
+  const std::string& GetOutputName(unsigned int i) const { return Outputs[i]; }
+
+  /// Number of points in the grid.
+  unsigned int GetNumPoints(void) const { return (unsigned int)Trimmed.size(); }
+
+  /// Converts a point number to its indices along each dimension.
+  void GetIndices(unsigned int point, std::vector<unsigned int>& indices) const;
+
+  /// Converts the indices along each dimension to a point number.
+  unsigned int GetPoint(const std::vector<unsigned int>& indices) const;
+
+  /// Value of each dimension property at a point.
+  void GetKeys(unsigned int point, std::vector<double>& keys) const;
+
+  /** Stores the result of a trim.
+      @param point point number
+      @param trimmed true if the trim succeeded
+      @param outputs values of the outputs (ignored if trimmed is false) */
+  void SetPoint(unsigned int point, bool trimmed,
+                const std::vector<double>& outputs);
+
+  bool IsTrimmed(unsigned int point) const { return Trimmed[point] != 0; }
+  double GetOutput(unsigned int point, unsigned int output) const
+  { return Values[point*Outputs.size()+output]; }
+
+  /** Interpolates the outputs at a flight condition. The interpolation is
+      multi-linear between the trimmed points of the cell that contains the
+      flight condition (the weights of the corners that could not be trimmed
+      are redistributed to the others). Keys outside of the grid are clamped
+      to its boundaries.
+      @param keys value of each dimension property
+      @param outputs interpolated value of each output
+      @return false if none of the corners of the cell has been trimmed */
+  bool Interpolate(const std::vector<double>& keys,
+                   std::vector<double>& outputs) const;
+
+  /// Saves the database to an XML file.
+  bool Save(const SGPath& filename) const;
+
+  /** Loads the database from an XML file.
+      @return false if the file is not a valid trim database */
+  bool Load(const SGPath& filename);
+
+private:
+  std::vector<std::string> Dimensions;
+  std::vector<std::vector<double> > Breakpoints;
+  std::vector<std::string> Outputs;
+  std::vector<char> Trimmed;
+  std::vector<double> Values;
+
+  void Resize(void);
+  void Debug(int from);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,244 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTrimSweep.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Trims an aircraft over a grid of flight conditions
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGTrimSweep.h"
+#include "FGFDMExec.h"
+#include "FGThreadPool.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGPropertyManager.h"
+#include "models/FGPropulsion.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGTrimSweep.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_TRIMSWEEP);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Trims one line of the grid (all the points along the last dimension) per
+// job, each point being warm started from the controls of the previous one.
+
+class FGTrimSweepLines : public FGThreadPool::Task
+{
+public:
+  FGTrimSweepLines(FGFDMExec* parent, vector<FGFDMExec*>& clones,
+                   FGTrimDatabase& db, TrimMode mode, TrimSolver solver)
+    : Parent(parent), Clones(clones), Database(db), Mode(mode), Solver(solver)
+  {
+    unsigned int nLines = Database.GetNumPoints()
+                        / Database.GetBreakpoints(Database.GetNumDimensions()-1).size();
+    Runs.assign(nLines, 0);
+  }
+
+  void Execute(unsigned int line, unsigned int worker)
+  {
+    FGFDMExec* fdm = Clones[worker];
+    FGPropertyManager* pm = fdm->GetPropertyManager();
+    unsigned int nDim = Database.GetNumDimensions();
+    unsigned int nOut = Database.GetNumOutputs();
+    unsigned int nLast = Database.GetBreakpoints(nDim-1).size();
+    vector<double> keys, outputs(nOut), guess;
+
+    // The clone may have trimmed other lines before: the controls and the
+    // engine states left by these trims would make the results depend on
+    // the lines handed out to each thread.
+    fdm->CopyStateFrom(Parent);
+
+    for (unsigned int k=0; k<nLast; k++) {
+      unsigned int point = line*nLast + k;
+
+      *fdm->GetIC() = *Parent->GetIC();
+      Database.GetKeys(point, keys);
+      for (unsigned int i=0; i<nDim; i++)
+        GetNode(pm, Database.GetDimensionName(i))->setDoubleValue(keys[i]);
+      fdm->RunIC();
+
+      FGTrim trim(fdm, Mode);
+      trim.SetSolver(Solver);
+      trim.SetInitialGuess(guess);
+      bool trimmed = trim.DoTrim();
+      Runs[line] += trim.GetRunCount();
+
+      if (trimmed) {
+        *fdm->GetIC() = trim.GetTrimIC();
+        for (unsigned int j=0; j<nOut; j++)
+          outputs[j] = GetNode(pm, Database.GetOutputName(j))->getDoubleValue();
+        guess = trim.GetControls();
+      } else
+        guess.clear();
+
+      Database.SetPoint(point, trimmed, outputs);
+    }
+  }
+
+  unsigned int GetRunCount(void) const
+  {
+    unsigned int total = 0;
+    for (unsigned int i=0; i<Runs.size(); i++) total += Runs[i];
+    return total;
+  }
+
+private:
+  FGFDMExec* Parent;
+  vector<FGFDMExec*>& Clones;
+  FGTrimDatabase& Database;
+  TrimMode Mode;
+  TrimSolver Solver;
+  vector<unsigned int> Runs;
+
+  static FGPropertyNode* GetNode(FGPropertyManager* pm, const string& name)
+  {
+    FGPropertyNode* node = pm->GetNode(name);
+    if (!node)
+      throw string("FGTrimSweep: property " + name + " does not exist");
+    return node;
+  }
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrimSweep::FGTrimSweep(FGFDMExec* FDMExec, TrimMode mode, TrimSolver solver)
+  : fdmex(FDMExec), Mode(mode), Solver(solver), RunCount(0)
+{
+  Debug(0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrimSweep::~FGTrimSweep(void)
+{
+  Debug(1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGTrimSweep::GetNumTrimmed(void) const
+{
+  unsigned int n = 0;
+  for (unsigned int p=0; p<Database.GetNumPoints(); p++)
+    if (Database.IsTrimmed(p)) n++;
+  return n;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTrimSweep::Run(unsigned int nThreads)
+{
+  RunCount = 0;
+  if (Database.GetNumDimensions() == 0) return true;
+
+  if (Database.GetNumOutputs() == 0) {
+    Database.AddOutput("ic/alpha-deg");
+    Database.AddOutput("ic/beta-deg");
+    Database.AddOutput("ic/phi-deg");
+    for (unsigned int i=0; i<fdmex->GetPropulsion()->GetNumEngines(); i++)
+      Database.AddOutput(CreateIndexedPropertyName("fcs/throttle-cmd-norm", i));
+    Database.AddOutput("fcs/pitch-trim-cmd-norm");
+    Database.AddOutput("fcs/elevator-cmd-norm");
+    Database.AddOutput("fcs/aileron-cmd-norm");
+    Database.AddOutput("fcs/rudder-cmd-norm");
+  }
+
+  unsigned int nLines = Database.GetNumPoints()
+                      / Database.GetBreakpoints(Database.GetNumDimensions()-1).size();
+  if (nThreads == 0) nThreads = FGThreadPool::GetHardwareConcurrency();
+  if (nThreads > nLines) nThreads = nLines;
+
+  vector<FGFDMExec*> clones;
+  try {
+    for (unsigned int i=0; i<nThreads; i++) {
+      FGFDMExec* clone = fdmex->Clone();
+      if (!clone)
+        throw string("FGTrimSweep: the model could not be cloned");
+      clones.push_back(clone);
+    }
+
+    FGThreadPool pool(nThreads);
+    FGTrimSweepLines lines(fdmex, clones, Database, Mode, Solver);
+    pool.Run(lines, nLines);
+    RunCount = lines.GetRunCount();
+  } catch (...) {
+    for (unsigned int i=0; i<clones.size(); i++) delete clones[i];
+    throw;
+  }
+
+  for (unsigned int i=0; i<clones.size(); i++) delete clones[i];
+
+  unsigned int nTrimmed = GetNumTrimmed();
+  if (debug_lvl > 0)
+    cout << "  Trim sweep: " << nTrimmed << " out of " << Database.GetNumPoints()
+         << " points trimmed (" << RunCount << " runs)" << endl;
+
+  return nTrimmed == Database.GetNumPoints();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//    The bitmasked value choices are as follows:
+//    unset: In this case (the default) JSBSim would only print
+//       out the normally expected messages, essentially echoing
+//       the config files as they are read. If the environment
+//       variable is not set, debug_lvl is set to 1 internally
+//    0: This requests JSBSim not to output any messages
+//       whatsoever.
+//    1: This value explicity requests the normal JSBSim
+//       startup messages
+//    2: This value asks for a message to be printed out when
+//       a class is instantiated
+//    4: When this value is set, a message is displayed when a
+//       FGModel object executes its Run() method
+//    8: When this value is set, various runtime state variables
+//       are printed out periodically
+//    16: When set various parameters are sanity checked and
+//       a message is printed out when they go out of bounds
+
+void FGTrimSweep::Debug(int from)
+{
+  if (debug_lvl <= 0) return;
+
+  if (debug_lvl & 2 ) { // Instantiation/Destruction notification
+    if (from == 0) cout << "Instantiated: FGTrimSweep" << endl;
+    if (from == 1) cout << "Destroyed:    FGTrimSweep" << endl;
+  }
+  if (debug_lvl & 64) {
+    if (from == 0) { // Constructor
+      cout << IdSrc << endl;
+      cout << IdHdr << endl;
+    }
+  }
+}
+}
@@ -0,0 +1,154 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTrimSweep.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTRIMSWEEP_H
+#define FGTRIMSWEEP_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "FGTrim.h"
+#include "FGTrimDatabase.h"
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_TRIMSWEEP "$Id: FGTrimSweep.h,v 1.0 2026/10/18 Outerra Exp $"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Trims an aircraft over a grid of flight conditions.
+
+    The grid is made of properties, each one swept over a list of breakpoints
+    (see FGTrimDatabase). Any writable property can be used: the initial
+    conditions (ic/h-sl-ft, ic/vc-kts, ic/gamma-deg, ...), the mass properties
+    (inertia/pointmass-weight-lbs[i], inertia/pointmass-location-X-inches[i])
+    or the flight controls (fcs/flap-cmd-norm).
+
+    The model is cloned once per thread (see FGFDMExec::Clone()) and the grid
+    lines along the last dimension are trimmed concurrently. Within a line,
+    each point starts from the controls found for the previous point so that
+    only the first point of a line is trimmed from scratch. Each line starts
+    from the state of the executive (see FGFDMExec::CopyStateFrom()) and the
+    order in which its points are trimmed does not depend on the number of
+    threads, so the results do not either. The trims report their progress
+    at the current debug level, from all the threads.
+
+    Each point starts from the initial conditions of the executive at the
+    time Run() is called, then the grid properties are set and the trim is
+    executed. When it succeeds the trimmed initial conditions are applied and
+    the output properties are recorded in the database.
+
+    @code
+    FGTrimSweep sweep(fdmex, tLongitudinal);
+    sweep.AddDimension("ic/h-sl-ft", altitudes);
+    sweep.AddDimension("ic/vc-kts", speeds);
+    sweep.Run();
+    sweep.GetDatabase().Save(SGPath("c172_trim.xml"));
+    @endcode
+
+    If no output has been added, the angle of attack, sideslip and roll angle
+    (ic/alpha-deg, ic/beta-deg, ic/phi-deg) are recorded together with the
+    throttle of each engine, the pitch trim, elevator, aileron and rudder
+    commands.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTrimSweep : public FGJSBBase
+{
+public:
+  /** Constructor
+      @param fdmex the executive of the aircraft to trim. It must have a model
+                   loaded. It is not modified by the sweep.
+      @param mode trim mode used for each point
+      @param solver trim solver used for each point */
+  FGTrimSweep(FGFDMExec* fdmex, TrimMode mode = tLongitudinal,
+              TrimSolver solver = tSimultaneous);
+  ~FGTrimSweep(void);
+
+  /// See FGTrimDatabase::AddDimension()
+  void AddDimension(const std::string& property,
+                    const std::vector<double>& breakpoints)
+  { Database.AddDimension(property, breakpoints); }
+
+  /// See FGTrimDatabase::AddOutput()
+  void AddOutput(const std::string& property) { Database.AddOutput(property); }
+
+  /** Trims all the points of the grid.
+      @param nThreads number of threads (and model clones), 0 for the number
+                      of hardware threads.
+      @return true if all the points have been trimmed */
+  bool Run(unsigned int nThreads = 0);
+
+  /// Returns the results of the last sweep.
+  const FGTrimDatabase& GetDatabase(void) const { return Database; }
+
+  /// Number of points trimmed by the last sweep.
+  unsigned int GetNumTrimmed(void) const;
+
+  /// Total number of FDM runs spent by the trims of the last sweep.
+  unsigned int GetRunCount(void) const { return RunCount; }
+
+private:
+  FGFDMExec* fdmex;
+  TrimMode Mode;
+  TrimSolver Solver;
+  FGTrimDatabase Database;
+  unsigned int RunCount;
+
+  void Debug(int from);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -38,6 +38,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <atomic>
+
 #ifndef NOSIMGEAR
     #include "simgear/structure/SGReferenced.hxx"
     #include "simgear/structure/SGSharedPtr.hxx"
@@ -156,7 +158,8 @@ public:
   void SetTime(double _time) { time = _time; }
 
 private:
-  double time;
+  // Written by every FDM sharing the callback (child FDMs run concurrently).
+  std::atomic<double> time;
 };
 
 typedef SGSharedPtr<FGGroundCallback> FGGroundCallback_ptr;
@@ -28,6 +28,8 @@
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
+
 #include "FGPropertyManager.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -432,4 +434,90 @@ void FGPropertyManager::Tie (const string &name, double *pointer, bool useDefaul
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyReads::Begin(void)
+{
+  if (Suspended > 0) return;
+
+  Recording = true;
+  Log.clear();
+  Previous = SGPropertyNode::setReadLog(&Log);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyReads::End(void)
+{
+  if (!Recording) return;
+  Recording = false;
+
+  // The values of the tied properties must not be logged again.
+  SGPropertyNode::setReadLog(0);
+
+  sort(Log.begin(), Log.end());
+  Log.erase(unique(Log.begin(), Log.end()), Log.end());
+
+  Reads.resize(Log.size());
+  for (unsigned int i=0; i<Log.size(); i++) {
+    Read& read = Reads[i];
+    read.Node = Log[i];
+    read.Tied = read.Node->isTied();
+    read.Version = read.Node->getVersion();
+    read.Value = read.Tied ? read.Node->getDoubleValue() : 0.0;
+  }
+
+  if (Previous) Previous->insert(Previous->end(), Log.begin(), Log.end());
+  SGPropertyNode::setReadLog(Previous);
+  Previous = 0;
+  Valid = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGPropertyReads::Changed(void)
+{
+  if (Suspended > 0) {
+    Suspended--;
+    return true;
+  }
+  if (!Valid) return true;
+
+  SGPropertyNode::ReadLog* outer = SGPropertyNode::setReadLog(0);
+  bool changed = false;
+
+  for (unsigned int i=0; i<Reads.size(); i++) {
+    const Read& read = Reads[i];
+    if (read.Node->isTied() != read.Tied
+        || (read.Tied ? read.Node->getDoubleValue() != read.Value
+                      : read.Node->getVersion() != read.Version)) {
+      changed = true;
+      break;
+    }
+  }
+
+  SGPropertyNode::setReadLog(outer);
+
+  if (changed) {
+    if (++Misses >= 4) {
+      Misses = 0;
+      Suspended = 32;
+      Valid = false;
+    }
+  } else {
+    Misses = 0;
+    // The outer evaluation depends on the properties of the skipped one.
+    if (outer) outer->insert(outer->end(), Log.begin(), Log.end());
+  }
+
+  return changed;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGPropertyReads::Contains(const SGPropertyNode* node) const
+{
+  return Valid && binary_search(Log.begin(), Log.end(), node);
+}
+
 } // namespace JSBSim
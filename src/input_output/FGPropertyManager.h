@@ -699,6 +699,71 @@ class FGPropertyManager
     std::vector<SGPropertyNode_ptr> tied_properties;
     FGPropertyNode_ptr root;
 };
+
+/** Records the properties read during an evaluation (of an FCS component, a
+    function, ...) and tells whether any of them has been modified since.
+
+    The properties that are not tied are checked with their version counter
+    (see SGPropertyNode::getVersion()). The value of a tied property can change
+    without its node knowing about it, so its value is compared to the value
+    it had at the end of the recording instead.
+
+    Recordings can be nested: the properties read during an inner recording,
+    or needed by an inner evaluation that has been skipped, are also added to
+    the outer recording.
+
+    Recording costs more than it saves when the properties change at each
+    evaluation. After a few evaluations in a row where a change is detected,
+    the recording is therefore suspended for a while: Changed() then returns
+    true and Begin() and End() do nothing.
+
+    @code
+    if (reads.Changed()) {
+      reads.Begin();
+      value = Evaluate();
+      reads.End();
+    }
+    @endcode
+  */
+class JSBSIM_API FGPropertyReads
+{
+  public:
+    FGPropertyReads(void)
+      : Previous(0), Valid(false), Recording(false), Misses(0), Suspended(0) {}
+
+    /// Starts recording the properties read by the calling thread.
+    void Begin(void);
+
+    /// Stops the recording.
+    void End(void);
+
+    /** Tells if one of the recorded properties has been modified since the
+        recording.
+        @return true if a property has been modified or if nothing has been
+                recorded yet. */
+    bool Changed(void);
+
+    /// Tells if the node has been read during the recording.
+    bool Contains(const SGPropertyNode* node) const;
+
+    /// Discards the recording so that Changed() returns true.
+    void Clear(void) { Valid = false; Misses = 0; Suspended = 0; }
+
+  private:
+    struct Read {
+      const SGPropertyNode* Node;
+      unsigned int Version;
+      double Value;
+      bool Tied;
+    };
+    SGPropertyNode::ReadLog Log;
+    SGPropertyNode::ReadLog* Previous;
+    std::vector<Read> Reads;
+    bool Valid;
+    bool Recording;
+    unsigned int Misses;    // consecutive evaluations with a change
+    unsigned int Suspended; // evaluations left before recording again
+};
 }
 #endif // FGPROPERTYMANAGER_H
 
@@ -44,6 +44,7 @@ INCLUDES
 #include <iostream>
 #include <cstdlib>
 #include <iomanip>
+#include <algorithm>
 
 #include "FGScript.h"
 #include "FGFDMExec.h"
@@ -74,6 +75,10 @@ CLASS IMPLEMENTATION
 FGScript::FGScript(FGFDMExec* fgex) : FDMExec(fgex)
 {
   PropertyManager=FDMExec->GetPropertyManager();
+  Scheduling = true;
+  Running = false;
+  EventsReset = false;
+  Silent = false;
 
   Debug(0);
 }
@@ -313,7 +318,7 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
         newEvent->Functions.push_back((FGFunction*)0L);
       } else if (set_element->FindElement("function")) {
         value = 0.0;
-        newEvent->Functions.push_back(new FGFunction(PropertyManager, set_element->FindElement("function")));
+        newEvent->Functions.push_back(new FGFunction(FDMExec, set_element->FindElement("function")));
       }
       newEvent->SetValue.push_back(value);
       newEvent->OriginalValue.push_back(0.0);
@@ -347,6 +352,8 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
 
   Debug(4);
 
+  ScheduleEvents();
+
   return true;
 }
 
@@ -359,166 +366,305 @@ void FGScript::ResetEvents(void)
 
   for (unsigned int i=0; i<Events.size(); i++)
     Events[i].reset();
+
+  // When an event resets the simulation, RunScript() reschedules the events
+  // once it has processed them.
+  if (Running)
+    EventsReset = true;
+  else
+    ScheduleEvents();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The events which cannot be triggered before a given time wait in the queue.
+// As long as they are not triggered, processing them would have no effect.
 
-bool FGScript::RunScript(void)
+void FGScript::ScheduleEvents(void)
 {
-  unsigned i, j;
-  unsigned event_ctr = 0;
+  const SGPropertyNode* timeNode = PropertyManager->GetNode("simulation/sim-time-sec");
+
+  ActiveEvents.clear();
+  ScheduledEvents = std::priority_queue<ScheduledEvent, vector<ScheduledEvent>,
+                                        greater<ScheduledEvent> >();
+
+  for (unsigned int i=0; i<Events.size(); i++) {
+    double time;
+    if (timeNode && !Events[i].Triggered
+        && Events[i].Condition->GetLowerBound(timeNode, time))
+      ScheduledEvents.push(ScheduledEvent(time, i));
+    else
+      ActiveEvents.push_back(i);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::ActivateEvents(double currentTime)
+{
+  size_t nActive = ActiveEvents.size();
+
+  while (!ScheduledEvents.empty() && ScheduledEvents.top().first <= currentTime) {
+    ActiveEvents.push_back(ScheduledEvents.top().second);
+    ScheduledEvents.pop();
+  }
+
+  if (ActiveEvents.size() == nActive) return;
+
+  // Keep the definition order
+  sort(ActiveEvents.begin()+nActive, ActiveEvents.end());
+  inplace_merge(ActiveEvents.begin(), ActiveEvents.begin()+nActive,
+                ActiveEvents.end());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGScript::EvaluateCondition(struct event& thisEvent)
+{
+  if (thisEvent.Reads.Changed()) {
+    thisEvent.Reads.Begin();
+    try {
+      thisEvent.Pass = thisEvent.Condition->Evaluate();
+    } catch (...) {
+      thisEvent.Reads.End();
+      thisEvent.Reads.Clear();
+      throw;
+    }
+    thisEvent.Reads.End();
+  }
+
+  return thisEvent.Pass;
+}
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGScript::RunScript(void)
+{
   double currentTime = FDMExec->GetSimTime();
-  double newSetValue = 0;
+  bool retired = false;
 
   if (currentTime > EndTime) return false;
 
-  // Iterate over all events.
-  for (unsigned int ev_ctr=0; ev_ctr < Events.size(); ev_ctr++) {
+  if (!FDMExec->GetScriptScheduling()) {
+    RunAllEvents(currentTime);
+    return true;
+  }
+
+  if (!Scheduling) {
+    Scheduling = true;
+    ScheduleEvents();
+  }
 
-    struct event &thisEvent = Events[ev_ctr];
+  ActivateEvents(currentTime);
 
-    // Determine whether the set of conditional tests for this condition equate
-    // to true and should cause the event to execute. If the conditions evaluate 
-    // to true, then the event is triggered. If the event is not persistent,
-    // then this trigger will remain set true. If the event is persistent,
-    // the trigger will reset to false when the condition evaluates to false.
-    if (thisEvent.Condition->Evaluate()) {
-      if (!thisEvent.Triggered) {
+  // Iterate over the active events.
+  Running = true;
+  EventsReset = false;
 
-        // The conditions are true, do the setting of the desired Event parameters
-        for (i=0; i<thisEvent.SetValue.size(); i++) {
-          if (thisEvent.SetParam[i] == 0L) { // Late bind property if necessary
-            if (PropertyManager->HasNode(thisEvent.SetParamName[i])) {
-              thisEvent.SetParam[i] = PropertyManager->GetNode(thisEvent.SetParamName[i]);
-            } else {
-              throw("No property, \""+thisEvent.SetParamName[i]+"\" is defined.");
-            }
-          }
-          thisEvent.OriginalValue[i] = thisEvent.SetParam[i]->getDoubleValue();
-          if (thisEvent.Functions[i] != 0) { // Parameter should be set to a function value
-            try {
-              thisEvent.SetValue[i] = thisEvent.Functions[i]->GetValue();
-            } catch (string& msg) {
-              std::cerr << std::endl << "A problem occurred in the execution of the script. " << msg << endl;
-              throw;
-            }
+  try {
+    for (unsigned int ev_ctr=0; ev_ctr < ActiveEvents.size(); ev_ctr++) {
+      unsigned int event_ctr = ActiveEvents[ev_ctr];
+
+      RunEvent(event_ctr, currentTime);
+
+      // An event has reset the simulation: the remaining events are processed
+      // in their definition order as the schedule no longer applies.
+      if (EventsReset) {
+        for (++event_ctr; event_ctr < Events.size(); event_ctr++)
+          RunEvent(event_ctr, currentTime);
+        break;
+      }
+
+      if (Events[event_ctr].IsRetired()) {
+        ActiveEvents[ev_ctr] = (unsigned int)Events.size();
+        retired = true;
+      }
+    }
+  } catch (...) {
+    Running = false;
+    if (EventsReset) {
+      EventsReset = false;
+      ScheduleEvents();
+    }
+    throw;
+  }
+
+  Running = false;
+
+  if (EventsReset) {
+    EventsReset = false;
+    ScheduleEvents();
+  } else if (retired)
+    ActiveEvents.erase(remove(ActiveEvents.begin(), ActiveEvents.end(),
+                              (unsigned int)Events.size()),
+                       ActiveEvents.end());
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Processes every event and evaluates every condition, as the script did before
+// the events were scheduled. The events are rescheduled when the scheduling is
+// enabled again.
+
+void FGScript::RunAllEvents(double currentTime)
+{
+  Scheduling = false;
+
+  for (unsigned int event_ctr=0; event_ctr < Events.size(); event_ctr++) {
+    Events[event_ctr].Reads.Clear();
+    RunEvent(event_ctr, currentTime);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::RunEvent(unsigned int event_ctr, double currentTime)
+{
+  unsigned i, j;
+  double newSetValue = 0;
+  struct event &thisEvent = Events[event_ctr];
+
+
+  // Determine whether the set of conditional tests for this condition equate
+  // to true and should cause the event to execute. If the conditions evaluate 
+  // to true, then the event is triggered. If the event is not persistent,
+  // then this trigger will remain set true. If the event is persistent,
+  // the trigger will reset to false when the condition evaluates to false.
+  if (EvaluateCondition(thisEvent)) {
+    if (!thisEvent.Triggered) {
+
+      // The conditions are true, do the setting of the desired Event parameters
+      for (i=0; i<thisEvent.SetValue.size(); i++) {
+        if (thisEvent.SetParam[i] == 0L) { // Late bind property if necessary
+          if (PropertyManager->HasNode(thisEvent.SetParamName[i])) {
+            thisEvent.SetParam[i] = PropertyManager->GetNode(thisEvent.SetParamName[i]);
+          } else {
+            throw("No property, \""+thisEvent.SetParamName[i]+"\" is defined.");
           }
-          switch (thisEvent.Type[i]) {
-          case FG_VALUE:
-          case FG_BOOL:
-            thisEvent.newValue[i] = thisEvent.SetValue[i];
-            break;
-          case FG_DELTA:
-            thisEvent.newValue[i] = thisEvent.OriginalValue[i] + thisEvent.SetValue[i];
-            break;
-          default:
-            cerr << "Invalid Type specified" << endl;
-            break;
+        }
+        thisEvent.OriginalValue[i] = thisEvent.SetParam[i]->getDoubleValue();
+        if (thisEvent.Functions[i] != 0) { // Parameter should be set to a function value
+          try {
+            thisEvent.SetValue[i] = thisEvent.Functions[i]->GetValue();
+          } catch (string& msg) {
+            std::cerr << std::endl << "A problem occurred in the execution of the script. " << msg << endl;
+            throw;
           }
-          thisEvent.StartTime = currentTime + thisEvent.Delay;
-          thisEvent.ValueSpan[i] = thisEvent.newValue[i] - thisEvent.OriginalValue[i];
-          thisEvent.Transiting[i] = true;
         }
+        switch (thisEvent.Type[i]) {
+        case FG_VALUE:
+        case FG_BOOL:
+          thisEvent.newValue[i] = thisEvent.SetValue[i];
+          break;
+        case FG_DELTA:
+          thisEvent.newValue[i] = thisEvent.OriginalValue[i] + thisEvent.SetValue[i];
+          break;
+        default:
+          cerr << "Invalid Type specified" << endl;
+          break;
+        }
+        thisEvent.StartTime = currentTime + thisEvent.Delay;
+        thisEvent.ValueSpan[i] = thisEvent.newValue[i] - thisEvent.OriginalValue[i];
+        thisEvent.Transiting[i] = true;
       }
-      thisEvent.Triggered = true;
-
-    } else if (thisEvent.Persistent) { // If the event is persistent, reset the trigger.
-      thisEvent.Triggered = false; // Reset the trigger for persistent events
-      thisEvent.Notified = false;  // Also reset the notification flag
-    } else if (thisEvent.Continuous) { // If the event is continuous, reset the trigger.
-      thisEvent.Triggered = false; // Reset the trigger for persistent events
-      thisEvent.Notified = false;  // Also reset the notification flag
     }
+    thisEvent.Triggered = true;
+
+  } else if (thisEvent.Persistent) { // If the event is persistent, reset the trigger.
+    thisEvent.Triggered = false; // Reset the trigger for persistent events
+    thisEvent.Notified = false;  // Also reset the notification flag
+  } else if (thisEvent.Continuous) { // If the event is continuous, reset the trigger.
+    thisEvent.Triggered = false; // Reset the trigger for persistent events
+    thisEvent.Notified = false;  // Also reset the notification flag
+  }
 
-    if ((currentTime >= thisEvent.StartTime) && thisEvent.Triggered) {
+  if ((currentTime >= thisEvent.StartTime) && thisEvent.Triggered) {
 
-      for (i=0; i<thisEvent.SetValue.size(); i++) {
-        if (thisEvent.Transiting[i]) {
-          thisEvent.TimeSpan = currentTime - thisEvent.StartTime;
-          switch (thisEvent.Action[i]) {
-          case FG_RAMP:
-            if (thisEvent.TimeSpan <= thisEvent.TC[i]) {
-              newSetValue = thisEvent.TimeSpan/thisEvent.TC[i] * thisEvent.ValueSpan[i] + thisEvent.OriginalValue[i];
-            } else {
-              newSetValue = thisEvent.newValue[i];
-              if (thisEvent.Continuous != true) thisEvent.Transiting[i] = false;
-            }
-            break;
-          case FG_STEP:
+    for (i=0; i<thisEvent.SetValue.size(); i++) {
+      if (thisEvent.Transiting[i]) {
+        thisEvent.TimeSpan = currentTime - thisEvent.StartTime;
+        switch (thisEvent.Action[i]) {
+        case FG_RAMP:
+          if (thisEvent.TimeSpan <= thisEvent.TC[i]) {
+            newSetValue = thisEvent.TimeSpan/thisEvent.TC[i] * thisEvent.ValueSpan[i] + thisEvent.OriginalValue[i];
+          } else {
             newSetValue = thisEvent.newValue[i];
-
-            // If this is not a continuous event, reset the transiting flag.
-            // Otherwise, it is known that the event is a continuous event.
-            // Furthermore, if the event is to be determined by a function,
-            // then the function will be continuously calculated.
-            if (thisEvent.Continuous != true)
-              thisEvent.Transiting[i] = false;
-            else if (thisEvent.Functions[i] != 0)
-              newSetValue = thisEvent.Functions[i]->GetValue();
-
-            break;
-          case FG_EXP:
-            newSetValue = (1 - exp( -thisEvent.TimeSpan/thisEvent.TC[i] )) * thisEvent.ValueSpan[i] + thisEvent.OriginalValue[i];
-            break;
-          default:
-            cerr << "Invalid Action specified" << endl;
-            break;
+            if (thisEvent.Continuous != true) thisEvent.Transiting[i] = false;
           }
-          thisEvent.SetParam[i]->setDoubleValue(newSetValue);
+          break;
+        case FG_STEP:
+          newSetValue = thisEvent.newValue[i];
+
+          // If this is not a continuous event, reset the transiting flag.
+          // Otherwise, it is known that the event is a continuous event.
+          // Furthermore, if the event is to be determined by a function,
+          // then the function will be continuously calculated.
+          if (thisEvent.Continuous != true)
+            thisEvent.Transiting[i] = false;
+          else if (thisEvent.Functions[i] != 0)
+            newSetValue = thisEvent.Functions[i]->GetValue();
+
+          break;
+        case FG_EXP:
+          newSetValue = (1 - exp( -thisEvent.TimeSpan/thisEvent.TC[i] )) * thisEvent.ValueSpan[i] + thisEvent.OriginalValue[i];
+          break;
+        default:
+          cerr << "Invalid Action specified" << endl;
+          break;
         }
+        thisEvent.SetParam[i]->setDoubleValue(newSetValue);
       }
+    }
 
-      // Print notification values after setting them
-      if (thisEvent.Notify && !thisEvent.Notified) {
-        if (thisEvent.NotifyKML) {
-          cout << endl << "<Placemark>" << endl;
-          cout << "  <name> " << currentTime << " seconds" << " </name>" << endl;
-          cout << "  <description>" << endl;
-          cout << "  <![CDATA[" << endl;
-          cout << "  <b>" << thisEvent.Name << " (Event " << event_ctr << ")" << " executed at time: " << currentTime << "</b><br/>" << endl;
-        } else  {
-          cout << endl << underon
-               << highint << thisEvent.Name << normint << underoff
-               << " (Event " << event_ctr << ")" 
-               << " executed at time: " << highint << currentTime << normint << endl;
-        }
-        if (!thisEvent.Description.empty()) {
-          cout << "    " << thisEvent.Description << endl;
-        }
-        for (j=0; j<thisEvent.NotifyProperties.size();j++) {
-          if (thisEvent.NotifyProperties[j] == 0) {
-            if (PropertyManager->HasNode(thisEvent.NotifyPropertyNames[j])) {
-              thisEvent.NotifyProperties[j] = PropertyManager->GetNode(thisEvent.NotifyPropertyNames[j]);
-            } else {
-              throw("Could not find property named "+thisEvent.NotifyPropertyNames[j]+" in script.");
-            }
+    // A silent script skips the notifications
+    if (Silent) thisEvent.Notified = thisEvent.Notify;
+
+    // Print notification values after setting them
+    if (thisEvent.Notify && !thisEvent.Notified) {
+      if (thisEvent.NotifyKML) {
+        cout << endl << "<Placemark>" << endl;
+        cout << "  <name> " << currentTime << " seconds" << " </name>" << endl;
+        cout << "  <description>" << endl;
+        cout << "  <![CDATA[" << endl;
+        cout << "  <b>" << thisEvent.Name << " (Event " << event_ctr << ")" << " executed at time: " << currentTime << "</b><br/>" << endl;
+      } else  {
+        cout << endl << underon
+             << highint << thisEvent.Name << normint << underoff
+             << " (Event " << event_ctr << ")" 
+             << " executed at time: " << highint << currentTime << normint << endl;
+      }
+      if (!thisEvent.Description.empty()) {
+        cout << "    " << thisEvent.Description << endl;
+      }
+      for (j=0; j<thisEvent.NotifyProperties.size();j++) {
+        if (thisEvent.NotifyProperties[j] == 0) {
+          if (PropertyManager->HasNode(thisEvent.NotifyPropertyNames[j])) {
+            thisEvent.NotifyProperties[j] = PropertyManager->GetNode(thisEvent.NotifyPropertyNames[j]);
+          } else {
+            throw("Could not find property named "+thisEvent.NotifyPropertyNames[j]+" in script.");
           }
-          cout << "    " << thisEvent.DisplayString[j] << " = " << thisEvent.NotifyProperties[j]->getDoubleValue();
-          if (thisEvent.NotifyKML) cout << " <br/>";
-          cout << endl;
-        }
-        if (thisEvent.NotifyKML) {
-          cout << "  ]]>" << endl;
-          cout << "  </description>" << endl;
-          cout << "  <Point>" << endl;
-          cout << "    <altitudeMode> absolute </altitudeMode>" << endl;
-          cout << "    <extrude> 1 </extrude>" << endl;
-          cout << "    <coordinates>" << FDMExec->GetPropagate()->GetLongitudeDeg()
-            << "," << FDMExec->GetPropagate()->GetGeodLatitudeDeg()
-            << "," << FDMExec->GetPropagate()->GetAltitudeASLmeters() << "</coordinates>" << endl;
-          cout << "  </Point>" << endl;
-          cout << "</Placemark>" << endl;
         }
+        cout << "    " << thisEvent.DisplayString[j] << " = " << thisEvent.NotifyProperties[j]->getDoubleValue();
+        if (thisEvent.NotifyKML) cout << " <br/>";
         cout << endl;
-        thisEvent.Notified = true;
       }
-
+      if (thisEvent.NotifyKML) {
+        cout << "  ]]>" << endl;
+        cout << "  </description>" << endl;
+        cout << "  <Point>" << endl;
+        cout << "    <altitudeMode> absolute </altitudeMode>" << endl;
+        cout << "    <extrude> 1 </extrude>" << endl;
+        cout << "    <coordinates>" << FDMExec->GetPropagate()->GetLongitudeDeg()
+          << "," << FDMExec->GetPropagate()->GetGeodLatitudeDeg()
+          << "," << FDMExec->GetPropagate()->GetAltitudeASLmeters() << "</coordinates>" << endl;
+        cout << "  </Point>" << endl;
+        cout << "</Placemark>" << endl;
+      }
+      cout << endl;
+      thisEvent.Notified = true;
     }
 
-    event_ctr++;
   }
-  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
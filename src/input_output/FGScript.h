@@ -39,6 +39,9 @@ INCLUDES
 
 #include <vector>
 #include <map>
+#include <queue>
+#include <utility>
+#include <functional>
 
 #include "FGJSBBase.h"
 #include "FGPropertyReader.h"
@@ -161,6 +164,22 @@ CLASS DOCUMENTATION
     to be used are specified in the &quot;use&quot; lines. Next,
     comes the &quot;run&quot; section, where the conditions are
     described in &quot;event&quot; clauses.</p>
+
+    <h3>Event scheduling</h3>
+
+    The events are processed in the order of their definition, but only the
+    active ones are processed each frame:
+    - an event whose condition requires simulation/sim-time-sec to be above
+      (or equal to) a given time is kept in a time ordered queue and only
+      becomes active when that time is reached,
+    - the condition of an active event is only evaluated again when one of the
+      properties it has read has changed,
+    - an event that is neither persistent nor continuous is retired once it has
+      been triggered, has completed its actions and has been notified.
+    The cost of a frame therefore depends on the number of active events rather
+    than on the size of the script. ResetEvents() reschedules all the events.
+    When the property simulation/script-scheduling is set to 0, the condition
+    of every event is evaluated at every frame instead.
     @author Jon S. Berndt
     @version "$Id: FGScript.h,v 1.31 2017/02/25 14:23:18 bcoconni Exp $"
 */
@@ -199,6 +218,11 @@ public:
 
   void ResetEvents(void);
 
+  /** Suppresses the notifications of the events, for instance when the
+      script is run many times by FGMonteCarlo.
+      @param silent true to suppress the notifications */
+  void SetSilent(bool silent) { Silent = silent; }
+
 private:
   enum eAction {
     FG_RAMP  = 1,
@@ -239,8 +263,11 @@ private:
     std::vector <double>  ValueSpan;
     std::vector <bool>    Transiting;
     std::vector <FGFunction*> Functions;
+    FGPropertyReads  Reads; // properties read by the condition
+    bool             Pass;  // last value of the condition
 
     event() {
+      Pass = false;
       Triggered = false;
       Persistent = false;
       Continuous = false;
@@ -255,18 +282,44 @@ private:
       Triggered = false;
       Notified = false;
       StartTime = 0.0;
+      Reads.Clear();
+    }
+
+    /// True when the event has nothing left to do until the script is reset.
+    bool IsRetired(void) const {
+      if (Persistent || Continuous || !Triggered || (Notify && !Notified))
+        return false;
+      for (unsigned int i=0; i<Transiting.size(); i++)
+        if (Transiting[i]) return false;
+      return true;
     }
   };
 
+  typedef std::pair<double, unsigned int> ScheduledEvent; // time, event index
+
   std::string  ScriptName;
   double  StartTime;
   double  EndTime;
   std::vector <struct event> Events;
+  std::vector <unsigned int> ActiveEvents; // indices in definition order
+  std::priority_queue<ScheduledEvent, std::vector<ScheduledEvent>,
+                      std::greater<ScheduledEvent> > ScheduledEvents;
+
+  bool Scheduling;  // the events are scheduled (simulation/script-scheduling)
+  bool Running;     // RunScript() is processing the events
+  bool EventsReset; // the events have been reset by one of them
+  bool Silent;
 
   FGPropertyReader LocalProperties;
 
   FGFDMExec* FDMExec;
   FGPropertyManager* PropertyManager;
+
+  void ScheduleEvents(void);
+  void ActivateEvents(double currentTime);
+  void RunAllEvents(double currentTime);
+  bool EvaluateCondition(struct event& thisEvent);
+  void RunEvent(unsigned int event_ctr, double currentTime);
   void Debug(int from);
 };
 }
@@ -622,7 +622,7 @@ double Element::DisperseValue(Element *e, double val, const std::string& supplie
         value = (val + disp*grn)*(fabs(grn)/grn);
       }
     } else if (attType == "uniform" || attType == "uniformsigned") {
-      double urn = ((((double)rand()/RAND_MAX)-0.5)*2.0);
+      double urn = FGJSBBase::UniformRandomNumber();
       if (attType == "uniform") {
       value = val + disp * urn;
       } else { // Assume uniformsigned
@@ -66,14 +66,24 @@ FGColumnVector3::FGColumnVector3(void)
 string FGColumnVector3::Dump(const string& delimiter) const
 {
   ostringstream buffer;
-  buffer << std::setprecision(16) << data[0] << delimiter;
-  buffer << std::setprecision(16) << data[1] << delimiter;
-  buffer << std::setprecision(16) << data[2];
+  Dump(buffer, delimiter);
   return buffer.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+ostream& FGColumnVector3::Dump(ostream& os, const string& delimiter) const
+{
+  ios::fmtflags flags = os.flags(ios::dec | ios::skipws);
+  streamsize precision = os.precision(16);
+  os << data[0] << delimiter << data[1] << delimiter << data[2];
+  os.flags(flags);
+  os.precision(precision);
+  return os;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 ostream& operator<<(ostream& os, const FGColumnVector3& col)
 {
   os << col(1) << " , " << col(2) << " , " << col(3);
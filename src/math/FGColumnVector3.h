@@ -138,6 +138,14 @@ public:
       @return a string with the delimeter-separated contents of the vector  */
   std::string Dump(const std::string& delimeter) const;
 
+  /** Prints the contents of the vector to a stream with the same format as
+      Dump(delimeter), whatever the format flags of the stream, without
+      building an intermediate string.
+      @param os the output stream
+      @param delimeter the item separator (tab or comma)
+      @return the output stream */
+  std::ostream& Dump(std::ostream& os, const std::string& delimeter) const;
+
   /** Assignment operator.
       @param b source vector.
       Copy the content of the vector given in the argument into *this.   */
@@ -243,6 +243,39 @@ bool FGCondition::Evaluate(void )
   return pass;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A test "node ge/gt/eq value" bounds the node. An AND group is bounded by the
+// highest bound of its terms, an OR group by the lowest bound of its terms
+// provided that all of them are bounded.
+
+bool FGCondition::GetLowerBound(const SGPropertyNode* node, double& bound) const
+{
+  if (TestParam1 == 0L) {
+    bool found = false;
+
+    for (unsigned int i=0; i<conditions.size(); i++) {
+      double b;
+      if (conditions[i]->GetLowerBound(node, b)) {
+        if (!found || (Logic == eAND ? b > bound : b < bound)) bound = b;
+        found = true;
+      } else if (Logic != eAND)
+        return false;
+    }
+
+    return found;
+  }
+
+  if (TestParam2 != 0L || TestParam1->GetSign() != 1
+      || TestParam1->GetNode() != node)
+    return false;
+
+  if (Comparison != eGE && Comparison != eGT && Comparison != eEQ)
+    return false;
+
+  bound = TestValue;
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGCondition::PrintCondition(string indent)
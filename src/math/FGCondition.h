@@ -52,6 +52,8 @@ DEFINITIONS
 FORWARD DECLARATIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+class SGPropertyNode;
+
 namespace JSBSim {
 
 class FGPropertyManager;
@@ -79,6 +81,13 @@ public:
   bool Evaluate(void);
   void PrintCondition(std::string indent="  ");
 
+  /** Finds a lower bound of a property below which the condition cannot be
+      true, such as the time of a "simulation/sim-time-sec ge 10" test.
+      @param node the property
+      @param bound the lower bound, if any
+      @return true if the condition implies a lower bound of the property */
+  bool GetLowerBound(const SGPropertyNode* node, double& bound) const;
+
 private:
   enum eComparison {ecUndef=0, eEQ, eNE, eGT, eGE, eLT, eLE};
   enum eLogic {elUndef=0, eAND, eOR};
@@ -35,6 +35,7 @@ INCLUDES
 #include <cmath>
 
 #include "FGFunction.h"
+#include "FGFDMExec.h"
 #include "FGTable.h"
 #include "FGPropertyValue.h"
 #include "FGRealValue.h"
@@ -109,8 +110,8 @@ const std::string FGFunction::ifthen_string = "ifthen";
 const std::string FGFunction::switch_string = "switch";
 const std::string FGFunction::interpolate1d_string = "interpolate1d";
 
-FGFunction::FGFunction(FGPropertyManager* propMan, Element* el, const string& prefix)
-                                      : PropertyManager(propMan), Prefix(prefix)
+FGFunction::FGFunction(FGFDMExec* fdmex, Element* el, const string& prefix)
+  : FDMExec(fdmex), PropertyManager(fdmex->GetPropertyManager()), Prefix(prefix)
 {
   Element* element;
   string operation, property_name;
@@ -118,6 +119,9 @@ FGFunction::FGFunction(FGPropertyManager* propMan, Element* el, const string& pr
   cachedValue = -HUGE_VAL;
   invlog2val = 1.0/log10(2.0);
   pCopyTo = 0L;
+  Volatile = false;
+  LastValue = 0.0;
+  Evaluating = false;
 
   Name = el->GetAttributeValue("name");
   operation = el->GetName();
@@ -233,6 +237,8 @@ FGFunction::FGFunction(FGPropertyManager* propMan, Element* el, const string& pr
     cerr << "Bad operation " << operation << " detected in configuration file" << endl;
   }
 
+  if (Type == eRandom || Type == eUrandom) Volatile = true;
+
   element = el->GetElement();
   if (!element && Type != eRandom && Type != eUrandom && Type != ePi) {
     cerr << fgred << highint << endl;
@@ -317,7 +323,9 @@ FGFunction::FGFunction(FGPropertyManager* propMan, Element* el, const string& pr
                operation == switch_string ||
                operation == interpolate1d_string)
     {
-      Parameters.push_back(new FGFunction(PropertyManager, element, Prefix));
+      FGFunction* f = new FGFunction(FDMExec, element, Prefix);
+      if (f->IsVolatile()) Volatile = true;
+      Parameters.push_back(f);
     } else if (operation != description_string) {
       cerr << "Bad operation " << operation << " detected in configuration file" << endl;
     }
@@ -370,6 +378,30 @@ double FGFunction::GetValue(void) const
 
   if (cached) return cachedValue;
 
+  // Change driven evaluation. A function being evaluated by another thread is
+  // evaluated normally.
+  if (Type == eTopLevel && !Volatile && FDMExec->GetChangeDriven()
+      && !Evaluating.exchange(true))
+  {
+    if (Reads.Changed()) {
+      Reads.Begin();
+      try {
+        LastValue = Parameters[0]->GetValue();
+      } catch (...) {
+        Reads.End();
+        Reads.Clear();
+        Evaluating = false;
+        throw;
+      }
+      Reads.End();
+      if (pCopyTo && Reads.Contains(pCopyTo)) Reads.Clear();
+    }
+    Evaluating = false;
+
+    if (pCopyTo) pCopyTo->setDoubleValue(LastValue);
+    return LastValue;
+  }
+
   if (   Type != eRandom
       && Type != eUrandom
       && Type != ePi      )
@@ -486,10 +518,10 @@ double FGFunction::GetValue(void) const
     temp = scratch;
     break;
   case eRandom:
-    temp = GaussianRandomNumber();
+    temp = FDMExec->GetRandom().GetNormal();
     break;
   case eUrandom:
-    temp = -1.0 + (((double)rand()/double(RAND_MAX))*2.0);
+    temp = FDMExec->GetRandom().GetUniformSigned();
     break;
   case ePi:
     temp = M_PI;
@@ -36,6 +36,7 @@ INCLUDES
 
 #include <vector>
 #include <string>
+#include <atomic>
 #include "FGParameter.h"
 #include "input_output/FGPropertyManager.h"
 
@@ -54,6 +55,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class Element;
+class FGFDMExec;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -662,6 +664,8 @@ of the three words refers to one or more instances of a property, value, or tabl
 - @b urandom Takes no arguments and returns a uniformly distributed random number
              between -1 and +1
     @code<urandom/>@endcode
+    Both draw from the random number generator of the FGFDMExec instance, so
+    the sequence is reproducible for a given simulation/randomseed.
 - @b pi Takes no argument and returns the value of Pi
     @code<pi/>@endcode
 - @b interpolate1d returns the result from a 1-dimensional interpolation of the
@@ -689,6 +693,11 @@ of the three words refers to one or more instances of a property, value, or tabl
        <v> 0.90 </v>  <v> 0.60 </v>
      </interpolate1d>
      @endcode
+
+When the property simulation/change-driven is set, a top level function that
+does not use random numbers is only evaluated again when one of the properties
+it read during its previous evaluation has changed.
+
 @author Jon Berndt
 */
 
@@ -712,12 +721,14 @@ public:
     in turn may each contain its own list, and so on. At runtime, each object
     evaluates its child parameters, which each may have its own child parameters to
     evaluate.
-    @param PropertyManager a pointer to the property manager instance.
+    @param fdmex a pointer to the executive that owns the function. Its property
+           manager is used to resolve the properties and its random number
+           generator feeds the random and urandom operations.
     @param element a pointer to the Element object containing the function definition.
     @param prefix an optional prefix to prepend to the name given to the property
            that represents this function (if given).
 */
-  FGFunction(FGPropertyManager* PropertyManager, Element* element, const std::string& prefix="");
+  FGFunction(FGFDMExec* fdmex, Element* element, const std::string& prefix="");
   /// Destructor.
   virtual ~FGFunction();
 
@@ -740,8 +751,13 @@ public:
     @param shouldCache specifies whether the function should cache the computed value. */
   void cacheValue(bool shouldCache);
 
+/** Tells if the value of the function can change while the properties it
+    reads keep the same value (i.e. if it uses random numbers). */
+  bool IsVolatile(void) const { return Volatile; }
+
 private:
   std::vector <FGParameter*> Parameters;
+  FGFDMExec* const FDMExec;
   FGPropertyManager* const PropertyManager;
   bool cached;
   double invlog2val;
@@ -813,6 +829,12 @@ private:
   std::string sCopyTo;        // Property name to copy function value to
   FGPropertyNode_ptr pCopyTo; // Property node for CopyTo property string
 
+  // Change driven evaluation (see the property simulation/change-driven)
+  bool Volatile;
+  mutable FGPropertyReads Reads;
+  mutable double LastValue;
+  mutable std::atomic<bool> Evaluating;
+
   unsigned int GetBinary(double) const;
   void bind(Element*);
   void Debug(int from);
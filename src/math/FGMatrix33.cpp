@@ -69,20 +69,32 @@ FGMatrix33::FGMatrix33(void)
 string FGMatrix33::Dump(const string& delimiter) const
 {
   ostringstream buffer;
-  buffer << setw(12) << setprecision(10) << data[0] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[3] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[6] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[1] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[4] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[7] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[2] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[5] << delimiter;
-  buffer << setw(12) << setprecision(10) << data[8];
+  Dump(buffer, delimiter);
   return buffer.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+ostream& FGMatrix33::Dump(ostream& os, const string& delimiter) const
+{
+  static const int order[9] = {0, 3, 6, 1, 4, 7, 2, 5, 8};
+  ios::fmtflags flags = os.flags(ios::dec | ios::skipws);
+  streamsize precision = os.precision(10);
+  char fill = os.fill(' ');
+
+  for (unsigned int i=0; i<9; i++) {
+    if (i > 0) os << delimiter;
+    os << setw(12) << data[order[i]];
+  }
+
+  os.flags(flags);
+  os.precision(precision);
+  os.fill(fill);
+  return os;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGMatrix33::Dump(const string& delimiter, const string& prefix) const
 {
   ostringstream buffer;
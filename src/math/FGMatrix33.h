@@ -163,6 +163,13 @@ public:
       @return a string with the delimeter-separated contents of the matrix  */
   std::string Dump(const std::string& delimeter) const;
 
+  /** Prints the contents of the matrix to a stream with the same format as
+      Dump(delimeter), whatever the format flags of the stream.
+      @param os the output stream
+      @param delimeter the item separator (tab or comma)
+      @return the output stream */
+  std::ostream& Dump(std::ostream& os, const std::string& delimeter) const;
+
   /** Prints the contents of the matrix.
       @param delimeter the item separator (tab or comma, etc.)
       @param prefix an additional prefix that is used to indent the 3X3 matrix printout
@@ -237,6 +244,20 @@ public:
    */
    unsigned int Cols(void) const { return eColumns; }
 
+  /** Comparison operator.
+      @param B other matrix.
+      Returns true if both matrices are exactly the same.   */
+  bool operator==(const FGMatrix33& B) const {
+    for (unsigned int i=0; i<eRows*eColumns; i++)
+      if (data[i] != B.data[i]) return false;
+    return true;
+  }
+
+  /** Comparison operator.
+      @param B other matrix.
+      Returns false if both matrices are exactly the same.   */
+  bool operator!=(const FGMatrix33& B) const { return ! operator==(B); }
+
   /** Transposed matrix.
       This function only returns the transpose of this matrix. This matrix itself
       remains unchanged.
@@ -43,6 +43,7 @@ INCLUDES
 
 #include "FGModelFunctions.h"
 #include "FGFunction.h"
+#include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
 
 using namespace std;
@@ -75,17 +76,17 @@ bool FGModelFunctions::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-bool FGModelFunctions::Load(Element* el, FGPropertyManager* PM, string prefix)
+bool FGModelFunctions::Load(Element* el, FGFDMExec* fdmex, string prefix)
 {
-  LocalProperties.Load(el, PM, false);
-  PreLoad(el, PM, prefix);
+  LocalProperties.Load(el, fdmex->GetPropertyManager(), false);
+  PreLoad(el, fdmex, prefix);
 
   return true; // TODO: Need to make this value mean something.
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGModelFunctions::PreLoad(Element* el, FGPropertyManager* PM, string prefix)
+void FGModelFunctions::PreLoad(Element* el, FGFDMExec* fdmex, string prefix)
 {
   // Load model post-functions, if any
 
@@ -94,7 +95,7 @@ void FGModelFunctions::PreLoad(Element* el, FGPropertyManager* PM, string prefix
   while (function) {
     string fType = function->GetAttributeValue("type");
     if (fType.empty() || fType == "pre")
-      PreFunctions.push_back(new FGFunction(PM, function, prefix));
+      PreFunctions.push_back(new FGFunction(fdmex, function, prefix));
 
     function = el->FindNextElement("function");
   }
@@ -102,14 +103,14 @@ void FGModelFunctions::PreLoad(Element* el, FGPropertyManager* PM, string prefix
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-void FGModelFunctions::PostLoad(Element* el, FGPropertyManager* PM, string prefix)
+void FGModelFunctions::PostLoad(Element* el, FGFDMExec* fdmex, string prefix)
 {
   // Load model post-functions, if any
 
   Element *function = el->FindElement("function");
   while (function) {
     if (function->GetAttributeValue("type") == "post") {
-      PostFunctions.push_back(new FGFunction(PM, function, prefix));
+      PostFunctions.push_back(new FGFunction(fdmex, function, prefix));
     }
     function = el->FindNextElement("function");
   }
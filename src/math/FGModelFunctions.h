@@ -58,6 +58,7 @@ namespace JSBSim {
 class FGFunction;
 class Element;
 class FGPropertyManager;
+class FGFDMExec;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -86,9 +87,9 @@ public:
   virtual ~FGModelFunctions();
   void RunPreFunctions(void);
   void RunPostFunctions(void);
-  bool Load(Element* el, FGPropertyManager* PropertyManager, std::string prefix="");
-  void PreLoad(Element* el, FGPropertyManager* PropertyManager, std::string prefix="");
-  void PostLoad(Element* el, FGPropertyManager* PropertyManager, std::string prefix="");
+  bool Load(Element* el, FGFDMExec* fdmex, std::string prefix="");
+  void PreLoad(Element* el, FGFDMExec* fdmex, std::string prefix="");
+  void PostLoad(Element* el, FGFDMExec* fdmex, std::string prefix="");
 
   /** Gets the strings for the current set of functions.
       @param delimeter either a tab or comma string depending on output type
@@ -19,12 +19,10 @@
 #include "FGNelderMead.h"
 #include <limits>
 #include <cmath>
-#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
-#include <ctime>
 
 namespace JSBSim
 {
@@ -35,7 +33,8 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
                            const std::vector<double> & initialStepSize, int iterMax,
                            double rtol, double abstol, double speed, double randomization,
                            bool showConvergeStatus,
-                           bool showSimplex, bool pause, Callback * callback) :
+                           bool showSimplex, bool pause, Callback * callback,
+                           unsigned int seed, unsigned long long stream) :
         m_f(f), m_callback(callback), m_randomization(randomization),
         m_lowerBound(lowerBound), m_upperBound(upperBound),
         m_nDim(initialGuess.size()), m_nVert(m_nDim+1),
@@ -46,9 +45,8 @@ FGNelderMead::FGNelderMead(Function * f, const std::vector<double> & initialGues
         iterMax(iterMax), iter(), rtol(rtol), abstol(abstol),
         speed(speed), showConvergeStatus(showConvergeStatus), showSimplex(showSimplex),
         pause(pause), rtolI(), minCostPrevResize(1), minCost(), minCostPrev(), maxCost(),
-        nextMaxCost()
+        nextMaxCost(), m_random(seed, stream)
 {
-    srand ( unsigned(time(NULL)) ); // seed random number generator
 }
 
 void FGNelderMead::update()
@@ -258,7 +256,9 @@ int FGNelderMead::status()
 
 double FGNelderMead::getRandomFactor()
 {
-    double randFact = 1+(float(rand() % 1000)/500-1)*m_randomization;
+    // each solver owns its generator so that a given seed and stream always
+    // produce the same sequence of simplices, whatever the other threads do
+    double randFact = 1+m_random.GetUniformSigned()*m_randomization;
     //std::cout << "random factor: " << randFact << std::endl;;
     return randFact;
 }
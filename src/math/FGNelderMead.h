@@ -22,6 +22,7 @@
 #include <vector>
 #include <limits>
 #include <cstddef>
+#include "FGRandom.h"
 
 namespace JSBSim
 {
@@ -52,7 +53,8 @@ public:
                  double randomization=0.1,
                  bool showConvergeStatus=true,bool showSimplex=false,
                  bool pause=false,
-                 Callback * callback=NULL);
+                 Callback * callback=NULL,
+                 unsigned int seed=0, unsigned long long stream=0);
     std::vector<double> getSolution();
 
     void update();
@@ -78,6 +80,7 @@ private:
     bool showConvergeStatus, showSimplex, pause;
     double rtolI, minCostPrevResize, minCost, minCostPrev,
            maxCost, nextMaxCost;
+    FGRandom m_random;
 
     // methods
     double getRandomFactor();
@@ -64,19 +64,27 @@ FGPropertyValue::FGPropertyValue(std::string propName, FGPropertyManager* proper
 
 double FGPropertyValue::GetValue(void) const
 {
-  FGPropertyNode* node = PropertyNode;
-
   if (!PropertyNode) {
-    // The node cannot be cached since this is a const method.
-    node = PropertyManager->GetNode(PropertyName);
-    
-    if (!node) {
+    // Late binding: once the property exists, the node is kept so that the
+    // path is not looked up again at each evaluation.
+    PropertyNode = PropertyManager->GetNode(PropertyName);
+
+    if (!PropertyNode) {
       throw(std::string("FGPropertyValue::GetValue() The property " +
                         PropertyName + " does not exist."));
     }
   }
 
-  return node->getDoubleValue()*Sign;
+  return PropertyNode->getDoubleValue()*Sign;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGPropertyNode* FGPropertyValue::GetNode(void) const
+{
+  if (!PropertyNode) PropertyNode = PropertyManager->GetNode(PropertyName);
+
+  return PropertyNode;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
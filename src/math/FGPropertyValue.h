@@ -74,12 +74,17 @@ public:
 
   double GetValue(void) const;
   void SetNode(FGPropertyNode* node) {PropertyNode = node;}
+  /** Returns the property node, looking it up by its name if it has not been
+      bound yet (null if the property does not exist). */
+  FGPropertyNode* GetNode(void) const;
+  /// Returns -1 if the property value is negated, 1 otherwise.
+  int GetSign(void) const { return Sign; }
 
   std::string GetName(void) const;
 
 private:
   FGPropertyManager* PropertyManager; // Property root used to do late binding.
-  FGPropertyNode_ptr PropertyNode;
+  mutable FGPropertyNode_ptr PropertyNode; // bound on first successful lookup
   std::string PropertyName;
   int Sign;
 };
@@ -242,15 +242,25 @@ void FGQuaternion::ComputeDerivedUnconditional(void) const
 std::string FGQuaternion::Dump(const std::string& delimiter) const
 {
   std::ostringstream buffer;
-  buffer << std::setprecision(16) << data[0] << delimiter;
-  buffer << std::setprecision(16) << data[1] << delimiter;
-  buffer << std::setprecision(16) << data[2] << delimiter;
-  buffer << std::setprecision(16) << data[3];
+  Dump(buffer, delimiter);
   return buffer.str();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+std::ostream& FGQuaternion::Dump(std::ostream& os, const std::string& delimiter) const
+{
+  std::ios::fmtflags flags = os.flags(std::ios::dec | std::ios::skipws);
+  std::streamsize precision = os.precision(16);
+  os << data[0] << delimiter << data[1] << delimiter << data[2] << delimiter
+     << data[3];
+  os.flags(flags);
+  os.precision(precision);
+  return os;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 std::ostream& operator<<(std::ostream& os, const FGQuaternion& q)
 {
   os << q(1) << " , " << q(2) << " , " << q(3) << " , " << q(4);
@@ -488,6 +488,8 @@ public:
   static FGQuaternion zero(void) { return FGQuaternion( 0.0, 0.0, 0.0, 0.0 ); }
 
   std::string Dump(const std::string& delimiter) const;
+  /// Same as Dump(delimiter), printed to a stream.
+  std::ostream& Dump(std::ostream& os, const std::string& delimiter) const;
 
   friend FGQuaternion QExp(const FGColumnVector3& omega);
 
@@ -0,0 +1,89 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGRandom.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Counter based pseudo random number generator
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+
+#include "FGRandom.h"
+#include "FGJSBBase.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGRandom.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_RANDOM);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGRandom::FGRandom(unsigned int seed, unsigned long long stream)
+  : Stream(stream)
+{
+  Seed(seed);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRandom::Seed(unsigned int seed)
+{
+  SeedValue = seed;
+  Key = Mix(Mix(seed + 0x9E3779B97F4A7C15ULL) ^ Stream);
+  Counter = 0;
+  NextNormal = NormalBatchSize;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRandom::GetNormal(double* values, unsigned int n)
+{
+  for (unsigned int i=0; i<n; i++) values[i] = GetNormal();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Box-Muller transform. 1-U is used for the radius so that the logarithm
+// argument lies in (0, 1].
+
+void FGRandom::FillNormals(void)
+{
+  for (unsigned int i=0; i<NormalBatchSize; i+=2) {
+    double r = sqrt(-2.0 * log(1.0 - GetUniform()));
+    double theta = 2.0 * M_PI * GetUniform();
+    Normals[i] = r * cos(theta);
+    Normals[i+1] = r * sin(theta);
+  }
+  NextNormal = 0;
+}
+
+}
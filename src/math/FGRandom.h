@@ -0,0 +1,140 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGRandom.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGRANDOM_H
+#define FGRANDOM_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_RANDOM "$Id: FGRandom.h,v 1.0 2026/10/18 Outerra Exp $"
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Counter based pseudo random number generator.
+
+    The n-th number of a sequence is obtained by hashing the pair (key, n)
+    with the SplitMix64 finalizer, the key being derived from the seed and
+    from a stream number. The state of the generator is thus reduced to a
+    counter: it is cheap to copy, two generators with the same seed and
+    stream always deliver the same sequence, and generators with different
+    streams deliver independent sequences.
+
+    Each FGFDMExec instance owns its own generator (see
+    FGFDMExec::GetRandom()) so that several FDMs can run in the same process,
+    possibly in different threads, without sharing any state and still get
+    reproducible results. The seed is set through the property
+    simulation/randomseed.
+
+    Normally distributed numbers are computed by batches with the Box-Muller
+    transform. Each pair of normal numbers consumes exactly two uniform
+    numbers, so the counter only depends on how many numbers were drawn.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGRandom
+{
+public:
+  /** Constructor
+      @param seed seed of the sequence
+      @param stream index of the stream */
+  explicit FGRandom(unsigned int seed = 0, unsigned long long stream = 0);
+
+  /** Restarts the sequence.
+      @param seed the new seed */
+  void Seed(unsigned int seed);
+
+  /// Returns the seed of the sequence.
+  unsigned int GetSeed(void) const { return SeedValue; }
+
+  /// Returns the number of uniform numbers drawn since the last seeding.
+  unsigned long long GetCounter(void) const { return Counter; }
+
+  /// Returns a uniformly distributed number in [0, 1).
+  double GetUniform(void) {
+    return (double)(Next() >> 11) * (1.0 / 9007199254740992.0);
+  }
+
+  /// Returns a uniformly distributed number in [-1, 1).
+  double GetUniformSigned(void) { return 2.0 * GetUniform() - 1.0; }
+
+  /// Returns a normally distributed number (zero mean, unit variance).
+  double GetNormal(void) {
+    if (NextNormal == NormalBatchSize) FillNormals();
+    return Normals[NextNormal++];
+  }
+
+  /** Fills an array with normally distributed numbers.
+      @param values array to fill
+      @param n number of values */
+  void GetNormal(double* values, unsigned int n);
+
+private:
+  enum {NormalBatchSize = 16};
+
+  unsigned int SeedValue;
+  unsigned long long Stream;
+  unsigned long long Key;
+  unsigned long long Counter;
+  double Normals[NormalBatchSize];
+  unsigned int NextNormal;
+
+  unsigned long long Next(void) {
+    return Mix(Key + 0x9E3779B97F4A7C15ULL * ++Counter);
+  }
+
+  static unsigned long long Mix(unsigned long long z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  void FillNormals(void);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -18,6 +18,7 @@
 
 #include "initialization/FGInitialCondition.h"
 #include "FGStateSpace.h"
+#include "FGThreadPool.h"
 #include <limits>
 #include <iomanip>
 #include <string>
@@ -79,22 +80,7 @@ void FGStateSpace::numericalJacobian(std::vector< std::vector<double> >  & J, Co
             if (computeYDerivative) fn2 = y.getDeriv(iY);
             else fn2 = y.get(iY);
 
-			double diff1 = f1-fn1;
-			double diff2 = f2-fn2;
-
-			// correct for angle wrap
-			if (x.getComp(iX)->getUnit().compare("rad") == 0) {
-				while(diff1 > M_PI) diff1 -= 2*M_PI;
-				if(diff1 < -M_PI) diff1 += 2*M_PI;
-				if(diff2 > M_PI) diff2 -= 2*M_PI;
-				if(diff2 < -M_PI) diff2 += 2*M_PI;
-			} else if (x.getComp(iX)->getUnit().compare("deg") == 0) {
-				if(diff1 > 180) diff1 -= 360;
-				if(diff1 < -180) diff1 += 360;
-				if(diff2 > 180) diff2 -= 360;
-				if(diff2 < -180) diff2 += 360;
-			}
-            J[iY][iX] = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
+            J[iY][iX] = centralDifference(f1,f2,fn1,fn2,x.getComp(iX)->getUnit(),h);
 
             x.set(x0);
 
@@ -113,6 +99,152 @@ void FGStateSpace::numericalJacobian(std::vector< std::vector<double> >  & J, Co
     }
 }
 
+double FGStateSpace::centralDifference(double f1, double f2, double fn1, double fn2,
+                                       const std::string & unit, double h)
+{
+    double diff1 = f1-fn1;
+    double diff2 = f2-fn2;
+
+    // correct for angle wrap
+    if (unit.compare("rad") == 0) {
+        while(diff1 > M_PI) diff1 -= 2*M_PI;
+        if(diff1 < -M_PI) diff1 += 2*M_PI;
+        if(diff2 > M_PI) diff2 -= 2*M_PI;
+        if(diff2 < -M_PI) diff2 += 2*M_PI;
+    } else if (unit.compare("deg") == 0) {
+        if(diff1 > 180) diff1 -= 360;
+        if(diff1 < -180) diff1 += 360;
+        if(diff2 > 180) diff2 -= 360;
+        if(diff2 < -180) diff2 += 360;
+    }
+    return (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
+}
+
+// Evaluates one column of [A B] and [C D] per job: the state (or input)
+// component is perturbed by +h, +2h, -h and -2h and, for each perturbation,
+// all the state derivatives and outputs are evaluated at once.
+class FGStateSpaceColumns : public FGThreadPool::Task
+{
+public:
+    FGStateSpaceColumns(std::vector<FGStateSpace *> & replicas,
+                        const std::vector<double> & x0, const std::vector<double> & u0,
+                        std::vector< std::vector<double> > & A,
+                        std::vector< std::vector<double> > & B,
+                        std::vector< std::vector<double> > & C,
+                        std::vector< std::vector<double> > & D, double h) :
+            m_replicas(replicas), m_x0(x0), m_u0(u0),
+            m_A(A), m_B(B), m_C(C), m_D(D), m_h(h)
+    {
+    }
+    void Execute(unsigned int index, unsigned int worker)
+    {
+        FGStateSpace & ss = *m_replicas[worker];
+        size_t nX = ss.x.getSize();
+        size_t nY = ss.y.getSize();
+        bool isState = index < nX;
+        unsigned int iCol = isState ? index : index - nX;
+        FGStateSpace::ComponentVector & v = isState ? ss.x : ss.u;
+        std::vector< std::vector<double> > & Jx = isState ? m_A : m_B;
+        std::vector< std::vector<double> > & Jy = isState ? m_C : m_D;
+
+        // as in the serial path, the model is perturbed again before each
+        // evaluation: evaluating a derivative runs the model, which would
+        // otherwise move the state seen by the next evaluations
+        const double step[4] = {m_h, 2*m_h, -m_h, -2*m_h};
+        std::vector<double> dx[4], y[4];
+        for (int k=0;k<4;k++)
+        {
+            dx[k].resize(nX);
+            for (unsigned int iY=0;iY<nX;iY++)
+            {
+                perturb(ss,v,iCol,step[k]);
+                dx[k][iY] = ss.x.getDeriv(iY);
+            }
+            perturb(ss,v,iCol,step[k]);
+            y[k] = ss.y.get();
+        }
+
+        const std::string & unit = v.getComp(iCol)->getUnit();
+        for (unsigned int iY=0;iY<nX;iY++)
+            Jx[iY][iCol] = FGStateSpace::centralDifference(dx[0][iY],dx[1][iY],dx[2][iY],dx[3][iY],unit,m_h);
+        for (unsigned int iY=0;iY<nY;iY++)
+            Jy[iY][iCol] = FGStateSpace::centralDifference(y[0][iY],y[1][iY],y[2][iY],y[3][iY],unit,m_h);
+    }
+private:
+    void perturb(FGStateSpace & ss, FGStateSpace::ComponentVector & v,
+                 unsigned int iCol, double step)
+    {
+        ss.x.set(m_x0);
+        ss.u.set(m_u0);
+        v.set(iCol,v.get(iCol)+step);
+    }
+
+    std::vector<FGStateSpace *> & m_replicas;
+    const std::vector<double> & m_x0;
+    const std::vector<double> & m_u0;
+    std::vector< std::vector<double> > & m_A;
+    std::vector< std::vector<double> > & m_B;
+    std::vector< std::vector<double> > & m_C;
+    std::vector< std::vector<double> > & m_D;
+    double m_h;
+};
+
+void FGStateSpace::linearize(
+    std::vector<double> x0,
+    std::vector<double> u0,
+    std::vector<double> y0,
+    std::vector< std::vector<double> > & A,
+    std::vector< std::vector<double> > & B,
+    std::vector< std::vector<double> > & C,
+    std::vector< std::vector<double> > & D,
+    FGThreadPool & pool, const std::vector<FGFDMExec *> & fdms)
+{
+    double h = 1e-4;
+    size_t nX = x.getSize();
+    size_t nU = u.getSize();
+    size_t nY = y.getSize();
+
+    if (fdms.size() < pool.GetNumThreads())
+        throw std::string("FGStateSpace: not enough fdm instances for the thread pool");
+
+    A.assign(nX,std::vector<double>(nX));
+    B.assign(nX,std::vector<double>(nU));
+    C.assign(nY,std::vector<double>(nX));
+    D.assign(nY,std::vector<double>(nU));
+
+    std::vector<FGStateSpace *> replicas;
+    for (unsigned int i=0;i<pool.GetNumThreads();i++)
+        replicas.push_back(new FGStateSpace(*this,fdms[i]));
+
+    // some components cannot be cloned: evaluate the columns in this thread
+    if (!replicas[0]->replicates(*this))
+    {
+        for (unsigned int i=0;i<replicas.size();i++) delete replicas[i];
+        linearize(x0,u0,y0,A,B,C,D);
+        return;
+    }
+
+    FGStateSpaceColumns columns(replicas,x0,u0,A,B,C,D,h);
+    try
+    {
+        pool.Run(columns,(unsigned int)(nX+nU));
+    }
+    catch (...)
+    {
+        for (unsigned int i=0;i<replicas.size();i++) delete replicas[i];
+        throw;
+    }
+    for (unsigned int i=0;i<replicas.size();i++) delete replicas[i];
+
+    if (m_fdm->GetDebugLevel() > 1)
+    {
+        std::cout << std::scientific
+                  << "\nA=\n" << A << "\nB=\n" << B
+                  << "\nC=\n" << C << "\nD=\n" << D
+                  << std::fixed << std::endl;
+    }
+}
+
 std::ostream &operator<<( std::ostream &out, const FGStateSpace::Component &c )
 {
     out << "\t" << c.getName()
@@ -142,7 +274,7 @@ std::ostream &operator<<( std::ostream &out, const FGStateSpace &ss )
 std::ostream &operator<<( std::ostream &out, const std::vector< std::vector<double> > &vec2d )
 {
     const std::streamsize width = out.width();
-    int nI = vec2d.size();
+    size_t nI = vec2d.size();
     out << std::left << std::setw(1) << "[" << std::right;
     for (unsigned int i=0;i<nI;i++)
     {
@@ -169,7 +301,7 @@ std::ostream &operator<<( std::ostream &out, const std::vector< std::vector<doub
 std::ostream &operator<<( std::ostream &out, const std::vector<double> &vec )
 {
     const std::streamsize width = out.width();
-    int nI = vec.size();
+    size_t nI = vec.size();
     out << std::left << std::setw(1) << "[" << std::right;
     for (unsigned int i=0;i<nI;i++)
     {
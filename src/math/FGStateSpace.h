@@ -32,11 +32,15 @@
 #include <iostream>
 #include <limits>
 
+#ifdef _MSC_VER
 #pragma warning(disable: 4355) // 'this' : used in base member initializer list (class FGStateSpace)
+#endif
 
 namespace JSBSim
 {
 
+class FGThreadPool;
+
 class FGStateSpace
 {
 public:
@@ -54,6 +58,10 @@ public:
         virtual ~Component() {};
         virtual double get() const = 0;
         virtual void set(double val) = 0;
+        // copy of the component, not yet attached to any state space, or 0
+        // if the component cannot be copied (the parallel linearization then
+        // falls back to the serial one)
+        virtual Component * clone() const { return 0; }
         virtual double getDeriv() const
         {
             // by default should calculate using finite difference approx
@@ -207,6 +215,10 @@ public:
         void clear() {
             m_components.clear();
         }
+        void deleteComponents() {
+            for (unsigned int i=0;i<getSize();i++) delete m_components[i];
+            m_components.clear();
+        }
     private:
         FGStateSpace * m_stateSpace;
         FGFDMExec * m_fdm;
@@ -217,7 +229,18 @@ public:
     ComponentVector x, u, y;
 
     // constructor
-    FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm) {};
+    FGStateSpace(FGFDMExec * fdm) : x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm), m_ownsComponents(false) {};
+
+    // replicate the components of a state space on another instance of the
+    // same model, the replica owns (and deletes) its components and skips
+    // those which cannot be cloned
+    FGStateSpace(const FGStateSpace & ss, FGFDMExec * fdm) :
+            x(fdm,this), u(fdm,this), y(fdm,this), m_fdm(fdm), m_ownsComponents(true)
+    {
+        addClones(x,ss.x);
+        addClones(u,ss.u);
+        addClones(y,ss.y);
+    }
 
     void setFdm(FGFDMExec * fdm) { m_fdm = fdm; }
 
@@ -273,7 +296,15 @@ public:
     }
 
     // deconstructor
-    virtual ~FGStateSpace() {};
+    virtual ~FGStateSpace()
+    {
+        if (m_ownsComponents)
+        {
+            x.deleteComponents();
+            u.deleteComponents();
+            y.deleteComponents();
+        }
+    };
 
     // linearization function
     void linearize(std::vector<double> x0, std::vector<double> u0, std::vector<double> y0,
@@ -282,6 +313,20 @@ public:
                    std::vector< std::vector<double> > & C,
                    std::vector< std::vector<double> > & D);
 
+    // parallel linearization function, the columns of A, B, C and D are
+    // evaluated concurrently by the threads of the pool, each worker thread
+    // perturbing its own instance of the model (see FGFDMExec::Clone). The
+    // number of fdm instances must be at least the number of threads.
+    void linearize(std::vector<double> x0, std::vector<double> u0, std::vector<double> y0,
+                   std::vector< std::vector<double> > & A,
+                   std::vector< std::vector<double> > & B,
+                   std::vector< std::vector<double> > & C,
+                   std::vector< std::vector<double> > & D,
+                   FGThreadPool & pool, const std::vector<FGFDMExec *> & fdms);
+
+    // central finite difference from the values at x+h, x+2h, x-h and x-2h
+    static double centralDifference(double f1, double f2, double fn1, double fn2,
+                                    const std::string & unit, double h);
 
 private:
 
@@ -290,9 +335,29 @@ private:
                            ComponentVector & x, const std::vector<double> & y0,
                            const std::vector<double> & x0, double h=1e-5, bool computeYDerivative = false);
 
+    // add the clones of the components of src to dst
+    static void addClones(ComponentVector & dst, const ComponentVector & src)
+    {
+        for (unsigned int i=0;i<src.getSize();i++)
+        {
+            Component * comp = src.getComp(i)->clone();
+            if (comp) dst.add(comp);
+        }
+    }
+
+    // true if the replica has all the components of ss
+    bool replicates(const FGStateSpace & ss) const
+    {
+        return x.getSize() == ss.x.getSize() && u.getSize() == ss.u.getSize()
+            && y.getSize() == ss.y.getSize();
+    }
+
     // flight dynamcis model
     FGFDMExec * m_fdm;
 
+    // true for replicas, which own their components
+    bool m_ownsComponents;
+
 public:
 
     // components
@@ -301,6 +366,10 @@ public:
     {
     public:
         Vt() : Component("Vt","ft/s") {};
+        Component * clone() const
+        {
+            return new Vt(*this);
+        }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVt();
@@ -324,6 +393,10 @@ public:
     {
     public:
         VGround() : Component("VGround","ft/s") {};
+        Component * clone() const
+        {
+            return new VGround(*this);
+        }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVground();
@@ -338,6 +411,10 @@ public:
     {
     public:
         AccelX() : Component("AccelX","ft/s^2") {};
+        Component * clone() const
+        {
+            return new AccelX(*this);
+        }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(1);
@@ -352,6 +429,10 @@ public:
     {
     public:
         AccelY() : Component("AccelY","ft/s^2") {};
+        Component * clone() const
+        {
+            return new AccelY(*this);
+        }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(2);
@@ -366,6 +447,10 @@ public:
     {
     public:
         AccelZ() : Component("AccelZ","ft/s^2") {};
+        Component * clone() const
+        {
+            return new AccelZ(*this);
+        }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(3);
@@ -380,6 +465,10 @@ public:
     {
     public:
         Alpha() : Component("Alpha","rad") {};
+        Component * clone() const
+        {
+            return new Alpha(*this);
+        }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getalpha();
@@ -404,6 +493,10 @@ public:
     {
     public:
         Theta() : Component("Theta","rad") {};
+        Component * clone() const
+        {
+            return new Theta(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(2);
@@ -423,6 +516,10 @@ public:
     {
     public:
         Q() : Component("Q","rad/s") {};
+        Component * clone() const
+        {
+            return new Q(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(2);
@@ -441,6 +538,10 @@ public:
     {
     public:
         Alt() : Component("Alt","ft") {};
+        Component * clone() const
+        {
+            return new Alt(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetAltitudeASL();
@@ -459,6 +560,10 @@ public:
     {
     public:
         Beta() : Component("Beta","rad") {};
+        Component * clone() const
+        {
+            return new Beta(*this);
+        }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getbeta();
@@ -479,6 +584,10 @@ public:
     {
     public:
         Phi() : Component("Phi","rad") {};
+        Component * clone() const
+        {
+            return new Phi(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(1);
@@ -497,6 +606,10 @@ public:
     {
     public:
         P() : Component("P","rad/s") {};
+        Component * clone() const
+        {
+            return new P(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(1);
@@ -515,6 +628,10 @@ public:
     {
     public:
         R() : Component("R","rad/s") {};
+        Component * clone() const
+        {
+            return new R(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(3);
@@ -533,6 +650,10 @@ public:
     {
     public:
         Psi() : Component("Psi","rad") {};
+        Component * clone() const
+        {
+            return new Psi(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(3);
@@ -551,6 +672,10 @@ public:
     {
     public:
         ThrottleCmd() : Component("ThtlCmd","norm") {};
+        Component * clone() const
+        {
+            return new ThrottleCmd(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottleCmd(0);
@@ -567,6 +692,10 @@ public:
     {
     public:
         ThrottlePos() : Component("ThtlPos","norm") {};
+        Component * clone() const
+        {
+            return new ThrottlePos(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottlePos(0);
@@ -582,6 +711,10 @@ public:
     {
     public:
         DaCmd() : Component("DaCmd","norm") {};
+        Component * clone() const
+        {
+            return new DaCmd(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaCmd();
@@ -597,6 +730,10 @@ public:
     {
     public:
         DaPos() : Component("DaPos","norm") {};
+        Component * clone() const
+        {
+            return new DaPos(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaLPos();
@@ -612,6 +749,10 @@ public:
     {
     public:
         DeCmd() : Component("DeCmd","norm") {};
+        Component * clone() const
+        {
+            return new DeCmd(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetDeCmd();
@@ -627,6 +768,10 @@ public:
     {
     public:
         DePos() : Component("DePos","norm") {};
+        Component * clone() const
+        {
+            return new DePos(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetDePos();
@@ -641,6 +786,10 @@ public:
     {
     public:
         DrCmd() : Component("DrCmd","norm") {};
+        Component * clone() const
+        {
+            return new DrCmd(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrCmd();
@@ -656,6 +805,10 @@ public:
     {
     public:
         DrPos() : Component("DrPos","norm") {};
+        Component * clone() const
+        {
+            return new DrPos(*this);
+        }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrPos();
@@ -670,6 +823,10 @@ public:
     {
     public:
         Rpm0() : Component("Rpm0","rev/min") {};
+        Component * clone() const
+        {
+            return new Rpm0(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetRPM();
@@ -684,6 +841,10 @@ public:
     {
     public:
         Rpm1() : Component("Rpm1","rev/min") {};
+        Component * clone() const
+        {
+            return new Rpm1(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(1)->GetThruster()->GetRPM();
@@ -698,6 +859,10 @@ public:
     {
     public:
         Rpm2() : Component("Rpm2","rev/min") {};
+        Component * clone() const
+        {
+            return new Rpm2(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(2)->GetThruster()->GetRPM();
@@ -712,6 +877,10 @@ public:
     {
     public:
         Rpm3() : Component("Rpm3","rev/min") {};
+        Component * clone() const
+        {
+            return new Rpm3(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(3)->GetThruster()->GetRPM();
@@ -726,6 +895,10 @@ public:
     {
     public:
         PropPitch() : Component("Prop Pitch","deg") {};
+        Component * clone() const
+        {
+            return new PropPitch(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetPitch();
@@ -741,6 +914,10 @@ public:
     {
     public:
         Longitude() : Component("Longitude","rad") {};
+        Component * clone() const
+        {
+            return new Longitude(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLongitude();
@@ -759,6 +936,10 @@ public:
     {
     public:
         Latitude() : Component("Latitude","rad") {};
+        Component * clone() const
+        {
+            return new Latitude(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLatitude();
@@ -777,6 +958,10 @@ public:
     {
     public:
         Pi() : Component("P inertial","rad/s") {};
+        Component * clone() const
+        {
+            return new Pi(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(1);
@@ -798,6 +983,10 @@ public:
     {
     public:
         Qi() : Component("Q inertial","rad/s") {};
+        Component * clone() const
+        {
+            return new Qi(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(2);
@@ -819,6 +1008,10 @@ public:
     {
     public:
         Ri() : Component("R inertial","rad/s") {};
+        Component * clone() const
+        {
+            return new Ri(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(3);
@@ -840,6 +1033,10 @@ public:
     {
     public:
         Vn() : Component("Vel north","feet/s") {};
+        Component * clone() const
+        {
+            return new Vn(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(1);
@@ -859,6 +1056,10 @@ public:
     {
     public:
         Ve() : Component("Vel east","feet/s") {};
+        Component * clone() const
+        {
+            return new Ve(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(2);
@@ -878,6 +1079,10 @@ public:
     {
     public:
         Vd() : Component("Vel down","feet/s") {};
+        Component * clone() const
+        {
+            return new Vd(*this);
+        }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(3);
@@ -897,6 +1102,10 @@ public:
     {
     public:
         COG() : Component("Course Over Ground","rad") {};
+        Component * clone() const
+        {
+            return new COG(*this);
+        }
         double get() const
         {
             //cog = atan2(Ve,Vn)
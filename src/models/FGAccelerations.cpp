@@ -259,11 +259,20 @@ void FGAccelerations::ResolveFrictionForces(double dt)
 	vFrictionForces.InitMatrix();
 	vFrictionMoments.InitMatrix();
 
+	// The work arrays are sized after the capacity of the multipliers list,
+	// which is reserved at load time, so that they are not reallocated when
+	// the number of contacts changes.
+	size_t capacity = multipliers.capacity();
+	if (FrictionRHS.size() < capacity) {
+		FrictionMatrix.resize(capacity*capacity);
+		FrictionRHS.resize(capacity);
+	}
+
 	// If no gears are in contact with the ground then return
 	if (!n) return;
 
-	vector<double> a(n*n); // Will contain Jac*M^-1*Jac^T
-	vector<double> rhs(n);
+	vector<double>& a = FrictionMatrix; // Will contain Jac*M^-1*Jac^T
+	vector<double>& rhs = FrictionRHS;
 
 	for (unsigned int i = 0; i < n; i++) {
 		FGColumnVector3 v0 = invMass * multipliers[i]->jac0;
@@ -391,6 +391,8 @@ private:
   FGColumnVector3 vGravAccel;
   FGColumnVector3 vFrictionForces;
   FGColumnVector3 vFrictionMoments;
+  std::vector<double> FrictionMatrix; // Jac*M^-1*Jac^T
+  std::vector<double> FrictionRHS;
 
   int gravType;
   bool gravTorque;
@@ -90,6 +90,7 @@ FGAerodynamics::FGAerodynamics(FGFDMExec* FDMExec) : FGModel(FDMExec)
   bi2vel = ci2vel = 0.0;
   AeroRPShift = 0;
   vDeltaRP.InitMatrix();
+  Perf = FDMExec->GetPerfMonitor();
 
   bind();
 
@@ -200,12 +201,14 @@ bool FGAerodynamics::Run(bool Holding)
       // in a context that might have changed, but instead use the values that
       // have already been calculated for this frame.
       (*f)->cacheValue(true);
+      FGPerfMonitor::Scope timer(Perf, AeroFunctionsPerf[axis_ctr][f - array->begin()]);
       vFnative(axis_ctr+1) += (*f)->GetValue();
     }
 
     array = &AeroFunctionsAtCG[axis_ctr];
     for (f=array->begin(); f != array->end(); ++f) {
       (*f)->cacheValue(true); // Same as above
+      FGPerfMonitor::Scope timer(Perf, AeroFunctionsAtCGPerf[axis_ctr][f - array->begin()]);
       vFnativeAtCG(axis_ctr+1) += (*f)->GetValue();
     }
   }
@@ -284,6 +287,7 @@ bool FGAerodynamics::Run(bool Holding)
       // in a context that might have changed, but instead use the values that
       // have already been calculated for this frame.
       (*f)->cacheValue(true);
+      FGPerfMonitor::Scope timer(Perf, AeroFunctionsPerf[axis_ctr+3][f - array->begin()]);
       vMomentsMRC(axis_ctr+1) += (*f)->GetValue();
     }
   }
@@ -334,7 +338,7 @@ bool FGAerodynamics::Load(Element *document)
 
   if ((temp_element = document->FindElement("aero_ref_pt_shift_x"))) {
     function_element = temp_element->FindElement("function");
-    AeroRPShift = new FGFunction(PropertyManager, function_element);
+    AeroRPShift = new FGFunction(FDMExec, function_element);
   }
 
   axis_element = document->FindElement("axis");
@@ -351,7 +355,7 @@ bool FGAerodynamics::Load(Element *document)
       }
       if (!apply_at_cg) {
       try {
-        ca.push_back( new FGFunction(PropertyManager, function_element) );
+        ca.push_back( new FGFunction(FDMExec, function_element) );
       } catch (const string& str) {
         cerr << endl << fgred << "Error loading aerodynamic function in " 
              << current_func_name << ":" << str << " Aborting." << reset << endl;
@@ -359,7 +363,7 @@ bool FGAerodynamics::Load(Element *document)
       }
       } else {
         try {
-          ca_atCG.push_back( new FGFunction(PropertyManager, function_element) );
+          ca_atCG.push_back( new FGFunction(FDMExec, function_element) );
         } catch (const string& str) {
           cerr << endl << fgred << "Error loading aerodynamic function in " 
                << current_func_name << ":" << str << " Aborting." << reset << endl;
@@ -373,7 +377,19 @@ bool FGAerodynamics::Load(Element *document)
     axis_element = document->FindNextElement("axis");
   }
 
-  PostLoad(document, PropertyManager); // Perform base class Post-Load
+  Perf = FDMExec->GetPerfMonitor();
+  for (unsigned int i=0; i<6; i++) {
+    AeroFunctionsPerf[i].clear();
+    for (unsigned int j=0; j<AeroFunctions[i].size(); j++)
+      AeroFunctionsPerf[i].push_back(Perf->GetEntry("aerodynamics",
+                                       AeroFunctions[i][j]->GetName()));
+    AeroFunctionsAtCGPerf[i].clear();
+    for (unsigned int j=0; j<AeroFunctionsAtCG[i].size(); j++)
+      AeroFunctionsAtCGPerf[i].push_back(Perf->GetEntry("aerodynamics",
+                                           AeroFunctionsAtCG[i][j]->GetName()));
+  }
+
+  PostLoad(document, FDMExec); // Perform base class Post-Load
 
   return true;
 }
@@ -46,6 +46,7 @@ INCLUDES
 #include "math/FGFunction.h"
 #include "math/FGColumnVector3.h"
 #include "math/FGMatrix33.h"
+#include "FGPerfMonitor.h"
 
 #include "JSBSim_api.h"
 
@@ -239,6 +240,9 @@ private:
   FGColumnVector3 vFw;
   FGColumnVector3 vForces;
   AeroFunctionArray* AeroFunctionsAtCG;
+  FGPerfMonitor* Perf;
+  std::vector <FGPerfMonitor::Entry*> AeroFunctionsPerf[6];
+  std::vector <FGPerfMonitor::Entry*> AeroFunctionsAtCGPerf[6];
   FGColumnVector3 vFwAtCG;
   FGColumnVector3 vFnativeAtCG;
   FGColumnVector3 vForcesAtCG;
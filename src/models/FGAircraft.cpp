@@ -182,7 +182,7 @@ bool FGAircraft::Load(Element* el)
     }
   }
 
-  PostLoad(el, PropertyManager);
+  PostLoad(el, FDMExec);
 
   Debug(2);
 
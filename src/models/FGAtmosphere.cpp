@@ -66,6 +66,7 @@ FGAtmosphere::FGAtmosphere(FGFDMExec* fdmex) : FGModel(fdmex),
   Name = "FGAtmosphere";
 
   bind();
+  AtmosphereNode = PropertyManager->GetNode("atmosphere", true);
   Debug(0);
 }
 
@@ -113,21 +114,26 @@ bool FGAtmosphere::Run(bool Holding)
 
 void FGAtmosphere::Calculate(double altitude)
 {
-  FGPropertyNode* node = PropertyManager->GetNode();
-  if (!PropertyManager->HasNode("atmosphere/override/temperature"))
+  // The overrides are looked up child by child: a lookup by path would parse
+  // (and allocate) the path at each frame.
+  SGPropertyNode* override = AtmosphereNode->getChild("override");
+  SGPropertyNode* node = override ? override->getChild("temperature") : 0;
+  if (!node)
     Temperature = GetTemperature(altitude);
   else
-    Temperature = node->GetDouble("atmosphere/override/temperature");
+    Temperature = node->getDoubleValue();
 
-  if (!PropertyManager->HasNode("atmosphere/override/pressure"))
+  node = override ? override->getChild("pressure") : 0;
+  if (!node)
     Pressure = GetPressure(altitude);
   else
-    Pressure = node->GetDouble("atmosphere/override/pressure");
+    Pressure = node->getDoubleValue();
 
-  if (!PropertyManager->HasNode("atmosphere/override/density"))
+  node = override ? override->getChild("density") : 0;
+  if (!node)
     Density = Pressure/(Reng*Temperature);
   else
-    Density = node->GetDouble("atmosphere/override/density");
+    Density = node->getDoubleValue();
 
   Soundspeed  = sqrt(SHRatio*Reng*(Temperature));
   PressureAltitude = altitude;
@@ -40,6 +40,7 @@ INCLUDES
 
 #include <vector>
 #include "models/FGModel.h"
+#include "input_output/FGPropertyManager.h"
 
 #include "JSBSim_api.h"
 
@@ -231,6 +232,8 @@ protected:
   const double SutherlandConstant, Beta;
   double Viscosity, KinematicViscosity;
 
+  FGPropertyNode_ptr AtmosphereNode; // parent of the override/ properties
+
   /// Calculate the atmosphere for the given altitude.
   void Calculate(double altitude);
 
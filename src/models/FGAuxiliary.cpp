@@ -78,6 +78,8 @@ FGAuxiliary::FGAuxiliary(FGFDMExec* fdmex) : FGModel(fdmex)
   hoverbmac = hoverbcg = 0.0;
   Re = 0.0;
   Nz = Ny = 0.0;
+  LazyDerived = false;
+  DerivedValid = eAllDerived;
 
   vPilotAccel.InitMatrix();
   vPilotAccelN.InitMatrix();
@@ -116,6 +118,7 @@ bool FGAuxiliary::InitModel(void)
   hoverbmac = hoverbcg = 0.0;
   Re = 0.0;
   Nz = Ny = 0.0;
+  DerivedValid = eAllDerived;
 
   vPilotAccel.InitMatrix();
   vPilotAccelN.InitMatrix();
@@ -202,10 +205,6 @@ bool FGAuxiliary::Run(bool Holding)
 
   Vground = sqrt( in.vVel(eNorth)*in.vVel(eNorth) + in.vVel(eEast)*in.vVel(eEast) );
 
-  psigt = atan2(in.vVel(eEast), in.vVel(eNorth));
-  if (psigt < 0.0) psigt += 2*M_PI;
-  gamma = atan2(-in.vVel(eDown), Vground);
-
   tat = in.Temperature*(1 + 0.2*Mach*Mach); // Total Temperature, isentropic flow
   tatc = RankineToCelsius(tat);
 
@@ -226,6 +225,63 @@ bool FGAuxiliary::Run(bool Holding)
     vcas = veas = vtrue = 0.0;
   }
 
+  // The other derived quantities are computed now or when they are read.
+  if (LazyDerived)
+    DerivedValid.store(0, std::memory_order_release);
+  else {
+    CalculateGroundTrack();
+    CalculateAccelerations();
+    CalculateVRP();
+    CalculateHOverB();
+    DerivedValid.store(eAllDerived, std::memory_order_release);
+  }
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The inputs are not modified between two executions of Run() so the values
+// computed on demand are the same as if they had been computed by Run(). The
+// lock protects against concurrent readers such as parallel FCS channels.
+
+void FGAuxiliary::ComputeDerived(unsigned int group) const
+{
+  lock_guard<mutex> lock(DerivedMutex);
+
+  unsigned int valid = DerivedValid.load(std::memory_order_relaxed);
+  if (valid & group) return;
+
+  switch (group) {
+  case eGroundTrack:
+    CalculateGroundTrack();
+    break;
+  case eAccelerations:
+    CalculateAccelerations();
+    break;
+  case eVRP:
+    CalculateVRP();
+    break;
+  case eHOverB:
+    CalculateHOverB();
+    break;
+  }
+
+  DerivedValid.store(valid | group, std::memory_order_release);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::CalculateGroundTrack(void) const
+{
+  psigt = atan2(in.vVel(eEast), in.vVel(eNorth));
+  if (psigt < 0.0) psigt += 2*M_PI;
+  gamma = atan2(-in.vVel(eDown), Vground);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::CalculateAccelerations(void) const
+{
   vPilotAccel.InitMatrix();
   vNcg = in.vBodyAccel/in.SLGravity;
   // Nz is Acceleration in "g's", along normal axis (-Z body axis)
@@ -238,17 +294,23 @@ bool FGAuxiliary::Run(bool Holding)
   vNwcg(eZ) = 1.0 - vNwcg(eZ);
 
   vPilotAccelN = vPilotAccel / in.SLGravity;
+}
 
-  // VRP computation
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::CalculateVRP(void) const
+{
   vLocationVRP = in.vLocation.LocalToLocation( in.Tb2l * in.VRPBody );
+}
 
-  // Recompute some derived values now that we know the dependent parameters values ...
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::CalculateHOverB(void) const
+{
   hoverbcg = in.DistanceAGL / in.Wingspan;
 
   FGColumnVector3 vMac = in.Tb2l * in.RPBody;
   hoverbmac = (in.DistanceAGL + vMac(3)) / in.Wingspan;
-
-  return false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -432,9 +494,10 @@ void FGAuxiliary::bind(void)
   PropertyManager->Tie("position/distance-from-start-lon-mt", this, &FGAuxiliary::GetLongitudeRelativePosition);
   PropertyManager->Tie("position/distance-from-start-lat-mt", this, &FGAuxiliary::GetLatitudeRelativePosition);
   PropertyManager->Tie("position/distance-from-start-mag-mt", this, &FGAuxiliary::GetDistanceRelativePosition);
-  PropertyManager->Tie("position/vrp-gc-latitude_deg", &vLocationVRP, &FGLocation::GetLatitudeDeg);
-  PropertyManager->Tie("position/vrp-longitude_deg", &vLocationVRP, &FGLocation::GetLongitudeDeg);
-  PropertyManager->Tie("position/vrp-radius-ft", &vLocationVRP, &FGLocation::GetRadius);
+  PropertyManager->Tie("position/vrp-gc-latitude_deg", this, &FGAuxiliary::GetVRPLatitudeDeg);
+  PropertyManager->Tie("position/vrp-longitude_deg", this, &FGAuxiliary::GetVRPLongitudeDeg);
+  PropertyManager->Tie("position/vrp-radius-ft", this, &FGAuxiliary::GetVRPRadius);
+  PropertyManager->Tie("simulation/lazy-auxiliary", this, &FGAuxiliary::GetLazyDerived, &FGAuxiliary::SetLazyDerived);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -39,6 +39,9 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <atomic>
+#include <mutex>
+
 #include "FGModel.h"
 #include "math/FGColumnVector3.h"
 #include "math/FGMatrix33.h"
@@ -100,6 +103,24 @@ CLASS DOCUMENTATION
     mass, the acceleration vector is calculated. The term wdot is equivalent
     to the JSBSim vPQRdot vector, and the w parameter is equivalent to vPQR.
 
+    <h3>Lazy derived quantities</h3>
+
+    The quantities that the other models need every frame (airspeeds, angles
+    of attack and sideslip and their rates, dynamic pressures, Mach numbers,
+    wind axes, pitot and total temperature, ground speed) are always computed
+    by Run(). When simulation/lazy-auxiliary is set to 1, the quantities that
+    are only read by outputs, scripts or systems are instead computed the first
+    time they are read after Run(), from the inputs of that frame:
+    - the ground track and flight path angle,
+    - the pilot and CG accelerations (Nz, Ny, load factors),
+    - the location of the visual reference point,
+    - the height over wing span ratios.
+    The values are the same in both modes; an instance of which nobody reads
+    these quantities (such as AI traffic) skips their computation.
+
+    @property simulation/lazy-auxiliary 1 to compute the derived quantities
+              on demand, 0 (the default) to compute them every frame
+
     @author Tony Peden, Jon Berndt
     @version $Id: FGAuxiliary.h,v 1.31 2015/09/20 20:53:13 bcoconni Exp $
 */
@@ -160,22 +181,25 @@ public:
   double GetTotalTemperature(void) const { return tat; }
   double GetTAT_C(void) const { return tatc; }
 
-  double GetPilotAccel(int idx)  const { return vPilotAccel(idx);  }
-  double GetNpilot(int idx)      const { return vPilotAccelN(idx); }
+  double GetPilotAccel(int idx)  const { Derive(eAccelerations); return vPilotAccel(idx);  }
+  double GetNpilot(int idx)      const { Derive(eAccelerations); return vPilotAccelN(idx); }
   double GetAeroPQR(int axis)    const { return vAeroPQR(axis);    }
   double GetEulerRates(int axis) const { return vEulerRates(axis); }
 
-  const FGColumnVector3& GetPilotAccel (void) const { return vPilotAccel;  }
-  const FGColumnVector3& GetNpilot     (void) const { return vPilotAccelN; }
-  const FGColumnVector3& GetNcg        (void) const { return vNcg;         }
-  double GetNcg                     (int idx) const { return vNcg(idx);    }
+  const FGColumnVector3& GetPilotAccel (void) const { Derive(eAccelerations); return vPilotAccel;  }
+  const FGColumnVector3& GetNpilot     (void) const { Derive(eAccelerations); return vPilotAccelN; }
+  const FGColumnVector3& GetNcg        (void) const { Derive(eAccelerations); return vNcg;         }
+  double GetNcg                     (int idx) const { Derive(eAccelerations); return vNcg(idx);    }
   double GetNlf                        (void) const;
   const FGColumnVector3& GetAeroPQR    (void) const { return vAeroPQR;     }
   const FGColumnVector3& GetEulerRates (void) const { return vEulerRates;  }
   const FGColumnVector3& GetAeroUVW    (void) const { return vAeroUVW;     }
-  const FGLocation&      GetLocationVRP(void) const { return vLocationVRP; }
+  const FGLocation&      GetLocationVRP(void) const { Derive(eVRP); return vLocationVRP; }
 
-  double GethVRP(void) const { return vLocationVRP.GetAltitudeASL(); }
+  double GethVRP(void) const { Derive(eVRP); return vLocationVRP.GetAltitudeASL(); }
+  double GetVRPLatitudeDeg(void) const { Derive(eVRP); return vLocationVRP.GetLatitudeDeg(); }
+  double GetVRPLongitudeDeg(void) const { Derive(eVRP); return vLocationVRP.GetLongitudeDeg(); }
+  double GetVRPRadius(void) const { Derive(eVRP); return vLocationVRP.GetRadius(); }
   double GetAeroUVW (int idx) const { return vAeroUVW(idx); }
   double Getalpha   (void) const { return alpha;      }
   double Getbeta    (void) const { return beta;       }
@@ -225,18 +249,18 @@ public:
   double GetMachU         (void) const { return MachU;      }
 
   /** The vertical acceleration in g's of the aircraft center of gravity. */
-  double GetNz            (void) const { return Nz;         }
+  double GetNz            (void) const { Derive(eAccelerations); return Nz; }
 
   /** The lateral acceleration in g's of the aircraft center of gravity. */
-  double GetNy            (void) const { return Ny;         }
+  double GetNy            (void) const { Derive(eAccelerations); return Ny; }
 
-  const FGColumnVector3& GetNwcg(void) const { return vNwcg; }
+  const FGColumnVector3& GetNwcg(void) const { Derive(eAccelerations); return vNwcg; }
 
-  double GetHOverBCG(void) const { return hoverbcg; }
-  double GetHOverBMAC(void) const { return hoverbmac; }
+  double GetHOverBCG(void) const { Derive(eHOverB); return hoverbcg; }
+  double GetHOverBMAC(void) const { Derive(eHOverB); return hoverbmac; }
 
-  double GetGamma(void)              const { return gamma;         }
-  double GetGroundTrack(void)        const { return psigt;         }
+  double GetGamma(void)              const { Derive(eGroundTrack); return gamma; }
+  double GetGroundTrack(void)        const { Derive(eGroundTrack); return psigt; }
 
   double GetHeadWind(void) const;
   double GetCrossWind(void) const;
@@ -255,6 +279,12 @@ public:
 
   void SetAeroPQR(const FGColumnVector3& tt) { vAeroPQR = tt; }
 
+  /** Selects the lazy computation of the derived quantities.
+      @param lazy 1 to compute them when they are read, 0 to compute them
+                  every frame */
+  void SetLazyDerived(int lazy) { LazyDerived = lazy != 0; }
+  int GetLazyDerived(void) const { return LazyDerived ? 1 : 0; }
+
   struct Inputs {
     double Pressure;
     double Density;
@@ -302,10 +332,11 @@ private:
   FGMatrix33 mTb2w;
   FGMatrix33 mTw2p;
 
-  FGColumnVector3 vPilotAccel;
-  FGColumnVector3 vPilotAccelN;
-  FGColumnVector3 vNcg;
-  FGColumnVector3 vNwcg;
+  // Derived quantities which can be computed on demand.
+  mutable FGColumnVector3 vPilotAccel;
+  mutable FGColumnVector3 vPilotAccelN;
+  mutable FGColumnVector3 vNcg;
+  mutable FGColumnVector3 vNwcg;
   FGColumnVector3 vAeroPQR;
   FGColumnVector3 vAeroUVW;
   FGColumnVector3 vEuler;
@@ -313,7 +344,7 @@ private:
   FGColumnVector3 vMachUVW;
   FGColumnVector3 vWindUVW;
   FGColumnVector3 vPitotUVW;
-  FGLocation vLocationVRP;
+  mutable FGLocation vLocationVRP;
 
   double Vt, Vground, Vpitot;
   double Mach, MachU, MachPitot;
@@ -321,12 +352,30 @@ private:
   double Re; // Reynolds Number = V*c/mu
   double alpha, beta;
   double adot,bdot;
-  double psigt, gamma;
-  double Nz, Ny;
+  mutable double psigt, gamma;
+  mutable double Nz, Ny;
   double seconds_in_day;  // seconds since current GMT day began
   int    day_of_year;     // GMT day, 1 .. 366
 
-  double hoverbcg, hoverbmac;
+  mutable double hoverbcg, hoverbmac;
+
+  /// Groups of derived quantities computed together.
+  enum {eGroundTrack = 1, eAccelerations = 2, eVRP = 4, eHOverB = 8,
+        eAllDerived = 15};
+  bool LazyDerived;
+  mutable std::atomic<unsigned int> DerivedValid; // groups up to date
+  mutable std::mutex DerivedMutex;
+
+  /// Makes sure that a group of derived quantities is up to date.
+  void Derive(unsigned int group) const {
+    if (!(DerivedValid.load(std::memory_order_acquire) & group))
+      ComputeDerived(group);
+  }
+  void ComputeDerived(unsigned int group) const;
+  void CalculateGroundTrack(void) const;
+  void CalculateAccelerations(void) const;
+  void CalculateVRP(void) const;
+  void CalculateHOverB(void) const;
 
   void UpdateWindMatrices(void);
 
@@ -41,6 +41,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGBuoyantForces.h"
 #include "FGMassBalance.h"
+#include "FGThreadPool.h"
 #include "input_output/FGXMLElement.h"
 
 using namespace std;
@@ -54,10 +55,32 @@ IDENT(IdHdr,ID_BUOYANTFORCES);
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+// Executes the gas cells in parallel.
+class GasCellTask : public FGThreadPool::Task
+{
+public:
+  GasCellTask(const vector<FGGasCell*>& cells, double dt)
+    : Cells(cells), DeltaT(dt) {}
+  void Execute(unsigned int index, unsigned int) {
+    Cells[index]->Calculate(DeltaT);
+  }
+private:
+  const vector<FGGasCell*>& Cells;
+  double DeltaT;
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 FGBuoyantForces::FGBuoyantForces(FGFDMExec* FDMExec) : FGModel(FDMExec)
 {
   Name = "FGBuoyantForces";
 
+  CellRate = 1;
+  CellCounter = 0;
+  CellElapsed = 0.0;
+  CellThreads = 1;
+  CellPool = 0;
+
   NoneDefined = true;
 
   vTotalForces.InitMatrix();
@@ -74,6 +97,7 @@ FGBuoyantForces::~FGBuoyantForces()
 {
   for (unsigned int i=0; i<Cells.size(); i++) delete Cells[i];
   Cells.clear();
+  delete CellPool;
 
   Debug(1);
 }
@@ -86,6 +110,8 @@ bool FGBuoyantForces::InitModel(void)
 
   vTotalForces.InitMatrix();
   vTotalMoments.InitMatrix();
+  CellCounter = 0;
+  CellElapsed = 0.0;
 
   return true;
 }
@@ -103,8 +129,16 @@ bool FGBuoyantForces::Run(bool Holding)
   vTotalForces.InitMatrix();
   vTotalMoments.InitMatrix();
 
+  CellElapsed += in.TotalDeltaT;
+  if (++CellCounter >= CellRate || in.TotalDeltaT == 0.0) {
+    CalculateCells(CellElapsed);
+    CellCounter = 0;
+    CellElapsed = 0.0;
+  } else {
+    for (unsigned int i=0; i<Cells.size(); i++) Cells[i]->UpdateBuoyancy();
+  }
+
   for (unsigned int i=0; i<Cells.size(); i++) {
-    Cells[i]->Calculate(FDMExec->GetDeltaT());
     vTotalForces  += Cells[i]->GetBodyForces();
     vTotalMoments += Cells[i]->GetMoments();
   }
@@ -116,6 +150,31 @@ bool FGBuoyantForces::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGBuoyantForces::CalculateCells(double dt)
+{
+  if (CellThreads == 1 || Cells.size() < 2) {
+    for (unsigned int i=0; i<Cells.size(); i++) Cells[i]->Calculate(dt);
+  } else {
+    if (!CellPool) CellPool = new FGThreadPool(CellThreads);
+    GasCellTask task(Cells, dt);
+    CellPool->Run(task, (unsigned int)Cells.size());
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBuoyantForces::SetCellThreads(int n)
+{
+  if (n < 0) n = 1;
+  if (n == CellThreads) return;
+
+  CellThreads = n;
+  delete CellPool;
+  CellPool = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGBuoyantForces::Load(Element *document)
 {
   Element *gas_cell_element;
@@ -133,7 +192,7 @@ bool FGBuoyantForces::Load(Element *document)
     gas_cell_element = document->FindNextElement("gas_cell");
   }
   
-  PostLoad(document, PropertyManager);
+  PostLoad(document, FDMExec);
 
   if (!NoneDefined) {
     bind();
@@ -261,6 +320,12 @@ void FGBuoyantForces::bind(void)
                        (PGF)&FGBuoyantForces::GetForces, (PSF)0, false);
   PropertyManager->Tie("forces/fbz-buoyancy-lbs", this, eZ,
                        (PGF)&FGBuoyantForces::GetForces, (PSF)0, false);
+  PropertyManager->Tie("buoyant_forces/cell-rate", this,
+                       &FGBuoyantForces::GetCellRate,
+                       &FGBuoyantForces::SetCellRate);
+  PropertyManager->Tie("simulation/buoyancy-threads", this,
+                       &FGBuoyantForces::GetCellThreads,
+                       &FGBuoyantForces::SetCellThreads);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -60,6 +60,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGThreadPool;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -96,6 +98,16 @@ CLASS DOCUMENTATION
 
     See FGGasCell for the full configuration file format for gas cells.
 
+    The thermodynamics of the gas cells and of their ballonets vary slowly and
+    can be run at a lower rate: they are then executed every
+    buoyant_forces/cell-rate frames (default 1) over the time elapsed since
+    their last execution. In between, the volume of the cells is held and
+    their buoyancy is updated every frame for the current air density and
+    attitude. When an aircraft has many gas cells, they can be executed in
+    parallel by simulation/buoyancy-threads threads (default 1, 0 for the
+    number of hardware threads); the cells must then not read each other's
+    properties.
+
     @author Anders Gidenstam, Jon S. Berndt
     @version $Id: FGBuoyantForces.h,v 1.18 2013/11/24 11:40:55 bcoconni Exp $
 */
@@ -173,6 +185,11 @@ public:
       parameters */
   std::string GetBuoyancyValues(const std::string& delimeter);
 
+  int GetCellRate(void) const { return CellRate; }
+  void SetCellRate(int rate) { CellRate = rate < 1 ? 1 : rate; }
+  int GetCellThreads(void) const { return CellThreads; }
+  void SetCellThreads(int n);
+
   FGGasCell::Inputs in;
 
 private:
@@ -188,6 +205,13 @@ private:
 
   bool NoneDefined;
 
+  int CellRate;
+  int CellCounter;
+  double CellElapsed;     // [s] time elapsed since the last cell update
+  int CellThreads;
+  FGThreadPool* CellPool;
+
+  void CalculateCells(double dt);
   void bind(void);
 
   void Debug(int from);
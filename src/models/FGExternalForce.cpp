@@ -135,7 +135,7 @@ FGParameter* FGExternalForce::bind(Element *el, FGPropertyManager* pm,
 
   Element* function_element = el->FindElement("function");
   if (function_element) {
-    return new FGFunction(pm, function_element);
+    return new FGFunction(fdmex, function_element);
   } else {
     FGPropertyNode* node = pm->GetNode(magName, true);
     return new FGPropertyValue(node);
@@ -95,7 +95,7 @@ bool FGExternalReactions::Load(Element* el)
     moment_element = el->FindNextElement("moment");
   }
 
-  PostLoad(el, PropertyManager);
+  PostLoad(el, FDMExec);
 
   if (!Forces.empty()) bind();
 
@@ -40,9 +40,13 @@ INCLUDES
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <set>
+#include <algorithm>
+#include <cctype>
 
 #include "FGFCS.h"
 #include "FGFDMExec.h"
+#include "FGThreadPool.h"
 #include "FGGroundReactions.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGModelLoader.h"
@@ -64,6 +68,7 @@ INCLUDES
 #include "models/flight_control/FGAngles.h"
 #include "models/flight_control/FGDistributor.h"
 
+#include "models/flight_control/FGFCSKernel.h"
 #include "FGFCSChannel.h"
 
 using namespace std;
@@ -73,11 +78,93 @@ namespace JSBSim {
 IDENT(IdSrc,"$Id: FGFCS.cpp,v 1.98 2017/02/25 14:23:18 bcoconni Exp $");
 IDENT(IdHdr,ID_FCS);
 
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+LOCAL DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+
+typedef vector<const SGPropertyNode*> NodeVec;
+
+// Executes the channels of a stage of the parallel schedule.
+class ChannelStageTask : public FGThreadPool::Task
+{
+public:
+  ChannelStageTask(const vector<FGFCSChannel*>& channels,
+                   const vector<unsigned int>& stage)
+    : Channels(channels), Stage(stage) {}
+  void Execute(unsigned int index, unsigned int) {
+    Channels[Stage[index]]->Execute();
+  }
+private:
+  const vector<FGFCSChannel*>& Channels;
+  const vector<unsigned int>& Stage;
+};
+
+// Returns true if the word token of a channel definition can be the name of a
+// property. A leading minus sign is removed.
+bool IsPropertyToken(string& token)
+{
+  if (!token.empty() && token[0] == '-') token.erase(0,1);
+  if (token.empty()) return false;
+  return isalpha((unsigned char)token[0]) || token[0] == '_' || token[0] == '/';
+}
+
+void AddSubtree(const SGPropertyNode* node, set<const SGPropertyNode*>& nodes)
+{
+  nodes.insert(node);
+  for (int i=0; i<node->nChildren(); i++) AddSubtree(node->getChild(i), nodes);
+}
+
+// Returns the top level node (fcs, propulsion, ...) of the branch that contains
+// node, relative to the root of the FDM instance. The top level node of the
+// whole tree is returned for a node that does not belong to the instance.
+const SGPropertyNode* GetBranch(const SGPropertyNode* node,
+                                const SGPropertyNode* root)
+{
+  while (node->getParent() && node->getParent() != root
+         && node->getParent()->getParent())
+    node = node->getParent();
+  return node;
+}
+
+// Returns the node of a property or 0 if the property does not exist or if
+// path is not a valid property name.
+const SGPropertyNode* FindNode(FGPropertyManager* pm, const string& path)
+{
+  try {
+    return pm->GetNode()->getNode(path.c_str());
+  } catch (...) {
+    return 0;
+  }
+}
+
+void SortUnique(NodeVec& nodes)
+{
+  sort(nodes.begin(), nodes.end());
+  nodes.erase(unique(nodes.begin(), nodes.end()), nodes.end());
+}
+
+bool Intersect(const NodeVec& a, const NodeVec& b)
+{
+  NodeVec::const_iterator ia = a.begin(), ib = b.begin();
+  while (ia != a.end() && ib != b.end()) {
+    if (*ia < *ib) ++ia;
+    else if (*ib < *ia) ++ib;
+    else return true;
+  }
+  return false;
+}
+
+}
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
-FGFCS::FGFCS(FGFDMExec* fdm) : FGModel(fdm), ChannelRate(1)
+FGFCS::FGFCS(FGFDMExec* fdm) : FGModel(fdm), ChannelRate(1), FCSThreads(1),
+                                ChannelPool(0), FCSCompiled(0),
+                                ChannelsCompiled(false)
 {
   int i;
   Name = "FGFCS";
@@ -117,6 +204,8 @@ FGFCS::~FGFCS()
   for (i=0;i<SystemChannels.size();i++) delete SystemChannels[i];
   SystemChannels.clear();
 
+  delete ChannelPool;
+
   Debug(1);
 }
 
@@ -172,11 +261,31 @@ bool FGFCS::Run(bool Holding)
   for (i=0; i<PropAdvance.size(); i++) PropAdvance[i] = PropAdvanceCmd[i];
   for (i=0; i<PropFeather.size(); i++) PropFeather[i] = PropFeatherCmd[i];
 
-  // Execute system channels in order
-  for (i=0; i<SystemChannels.size(); i++) {
-    if (debug_lvl & 4) cout << "    Executing System Channel: " << SystemChannels[i]->GetName() << endl;
-    ChannelRate = SystemChannels[i]->GetRate();
-    SystemChannels[i]->Execute();
+  if (ChannelsCompiled != (FCSCompiled != 0)) CompileChannels();
+
+  if (FCSThreads == 1 || SystemChannels.size() < 2) {
+    // Execute system channels in order
+    for (i=0; i<SystemChannels.size(); i++) RunChannel(i);
+  } else {
+    // Execute the independent channels of each stage in parallel
+    if (ChannelStages.empty()) BuildChannelSchedule();
+    if (!ChannelPool) ChannelPool = new FGThreadPool(FCSThreads);
+
+    for (i=0; i<ChannelStages.size(); i++) {
+      const vector<unsigned int>& stage = ChannelStages[i];
+      if (stage.size() == 1)
+        RunChannel(stage[0]);
+      else {
+        if (debug_lvl & 4) {
+          for (unsigned int j=0; j<stage.size(); j++)
+            cout << "    Executing System Channel: "
+                 << SystemChannels[stage[j]]->GetName() << endl;
+        }
+        ChannelRate = 1;
+        ChannelStageTask task(SystemChannels, stage);
+        ChannelPool->Run(task, (unsigned int)stage.size());
+      }
+    }
   }
   ChannelRate = 1;
 
@@ -476,6 +585,205 @@ void FGFCS::SetPropFeather(int engineNum, bool setting)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCS::RunChannel(unsigned int i)
+{
+  if (debug_lvl & 4) cout << "    Executing System Channel: " << SystemChannels[i]->GetName() << endl;
+  ChannelRate = SystemChannels[i]->GetRate();
+  SystemChannels[i]->Execute();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCS::SetFCSThreads(int n)
+{
+  if (n < 0) n = 1;
+  if (n == FCSThreads) return;
+
+  FCSThreads = n;
+  delete ChannelPool;
+  ChannelPool = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The kernels are only replaced by Run() since the property could be set while
+// a channel is executing.
+
+void FGFCS::SetFCSCompiled(int n)
+{
+  FCSCompiled = n != 0 ? 1 : 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Compiles all the channels, or discards their kernels if the compiled mode is
+// off. Any component can read the output of a component of another channel so
+// the outputs of all the channels are mapped first.
+
+void FGFCS::CompileChannels(void)
+{
+  unsigned int i;
+
+  if (!FCSCompiled) {
+    for (i=0; i<SystemChannels.size(); i++) SystemChannels[i]->SetKernel(0);
+    ChannelsCompiled = false;
+    return;
+  }
+
+  FGFCSKernel::OutputMap outputs;
+  for (i=0; i<SystemChannels.size(); i++)
+    FGFCSKernel::MapOutputs(SystemChannels[i]->GetComponents(), outputs);
+
+  for (i=0; i<SystemChannels.size(); i++) {
+    FGFCSChannel* channel = SystemChannels[i];
+    FGFCSKernel* kernel = new FGFCSKernel(channel->GetComponents(), outputs);
+
+    if (debug_lvl & 1)
+      cout << "    Compiled " << kernel->GetNumCompiled() << " of "
+           << channel->GetNumComponents() << " components of channel "
+           << channel->GetName() << endl;
+
+    channel->SetKernel(kernel);
+  }
+
+  ChannelsCompiled = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Collects the properties read and written by the element el of a channel
+// definition and by its children. Any word of the element text that looks like
+// a property name is considered to be read, except in <output> and in the
+// <property> elements of a distributor case which are written.
+
+void FGFCS::ScanChannelAccess(Element* el, ChannelAccess& access)
+{
+  const string& name = el->GetName();
+
+  if (name == "description") return;
+  if (name == "noise" || name == "random" || name == "urandom")
+    access.Exclusive = true;
+
+  string value = el->GetAttributeValue("value");
+  if (IsPropertyToken(value)) access.Reads.push_back(value);
+
+  string copyto = el->GetAttributeValue("copyto");
+  if (!copyto.empty()) access.Writes.push_back(copyto);
+
+  // A named function is evaluated each time its property is read.
+  if (name == "function") {
+    string function_name = el->GetAttributeValue("name");
+    if (!function_name.empty())
+      access.Writes.push_back(PropertyManager->mkPropertyName(function_name, false));
+  }
+
+  if (name == "quantization") {
+    string quant_name = el->GetAttributeValue("name");
+    if (!quant_name.empty() && quant_name.find("/") == string::npos)
+      access.Owned.push_back("fcs/" + PropertyManager->mkPropertyName(quant_name, true));
+  }
+
+  bool output = name == "output" || (name == "property" && el->GetParent()
+                                     && el->GetParent()->GetName() == "case");
+  vector<string>& names = output ? access.Writes : access.Reads;
+
+  for (unsigned int i=0; i<el->GetNumDataLines(); i++) {
+    istringstream line(el->GetDataLine(i));
+    string token;
+    while (line >> token) {
+      if (IsPropertyToken(token)) names.push_back(token);
+    }
+  }
+
+  for (unsigned int i=0; i<el->GetNumElements(); i++)
+    ScanChannelAccess(el->GetElement(i), access);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Sorts the channels in stages of mutually independent channels. Each channel
+// is placed in the stage that follows the last previous channel it conflicts
+// with so that the order of execution of dependent channels is unchanged.
+
+void FGFCS::BuildChannelSchedule(void)
+{
+  unsigned int n = (unsigned int)SystemChannels.size();
+  const SGPropertyNode* channelDt = FindNode(PropertyManager, "simulation/channel-dt");
+
+  // The nodes tied by the components only give access to their members.
+  set<const SGPropertyNode*> owned;
+  for (unsigned int c=0; c<n; c++) {
+    const vector<string>& names = ChannelAccesses[c].Owned;
+    for (unsigned int i=0; i<names.size(); i++) {
+      const SGPropertyNode* node = FindNode(PropertyManager, names[i]);
+      if (node) AddSubtree(node, owned);
+    }
+  }
+
+  vector<NodeVec> reads(n), writes(n), tiedReads(n), tiedWrites(n);
+  vector<bool> exclusive(n);
+
+  for (unsigned int c=0; c<n; c++) {
+    const ChannelAccess& access = ChannelAccesses[c];
+    bool excl = access.Exclusive;
+
+    for (unsigned int k=0; k<3; k++) {
+      const vector<string>& names = k == 0 ? access.Reads
+                                           : (k == 1 ? access.Writes : access.Owned);
+      bool write = k > 0;
+
+      for (unsigned int i=0; i<names.size(); i++) {
+        string path = names[i];
+        if (path[0] == '-') path.erase(0,1);
+        const SGPropertyNode* node = FindNode(PropertyManager, path);
+
+        // A property that does not exist yet may be created at run time and
+        // bound to anything.
+        if (!node) {
+          if (path.find("/") != string::npos) excl = true;
+          continue;
+        }
+        if (node == channelDt) excl = true;
+
+        (write ? writes : reads)[c].push_back(node);
+
+        // Properties tied by other models may have side effects on the
+        // properties of the same branch.
+        if (node->isTied() && owned.find(node) == owned.end())
+          (write ? tiedWrites : tiedReads)[c].push_back(GetBranch(node, PropertyManager->GetNode()));
+      }
+    }
+
+    SortUnique(reads[c]);
+    SortUnique(writes[c]);
+    SortUnique(tiedReads[c]);
+    SortUnique(tiedWrites[c]);
+    exclusive[c] = excl;
+  }
+
+  vector<unsigned int> stage(n, 0);
+  unsigned int nStages = 0;
+
+  for (unsigned int j=0; j<n; j++) {
+    for (unsigned int i=0; i<j; i++) {
+      if (stage[i] + 1 <= stage[j]) continue;
+      if (exclusive[i] || exclusive[j]
+          || Intersect(writes[i], reads[j]) || Intersect(writes[i], writes[j])
+          || Intersect(reads[i], writes[j])
+          || Intersect(tiedWrites[i], tiedReads[j])
+          || Intersect(tiedWrites[i], tiedWrites[j])
+          || Intersect(tiedReads[i], tiedWrites[j]))
+        stage[j] = stage[i] + 1;
+    }
+    nStages = max(nStages, stage[j] + 1);
+  }
+
+  ChannelStages.assign(nStages, vector<unsigned int>());
+  for (unsigned int j=0; j<n; j++) ChannelStages[stage[j]].push_back(j);
+
+  if (debug_lvl > 0)
+    cout << endl << "    " << n << " system channels scheduled in " << nStages
+         << " stages" << endl;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGFCS::Load(Element* document)
 {
   if (document->GetName() == "autopilot") {
@@ -497,6 +805,13 @@ bool FGFCS::Load(Element* document)
 
   Debug(2);
 
+  // The channel schedule and the kernels are rebuilt when the channels are
+  // next run.
+  ChannelStages.clear();
+  for (unsigned int i=0; i<SystemChannels.size(); i++)
+    SystemChannels[i]->SetKernel(0);
+  ChannelsCompiled = false;
+
   Element* channel_element = document->FindElement("channel");
   
   while (channel_element) {
@@ -524,7 +839,14 @@ bool FGFCS::Load(Element* document)
     } else
       newChannel = new FGFCSChannel(this, sChannelName, Rate);
 
+    string sEssential = channel_element->GetAttributeValue("essential");
+    if (sEssential == "false" || sEssential == "0")
+      newChannel->SetEssential(false);
+
     SystemChannels.push_back(newChannel);
+    ChannelAccesses.push_back(ChannelAccess());
+    ChannelAccess& access = ChannelAccesses.back();
+    if (!sOnOffProperty.empty()) access.Reads.push_back(sOnOffProperty);
 
     if (debug_lvl > 0)
       cout << endl << highint << fgblue << "    Channel " 
@@ -532,6 +854,7 @@ bool FGFCS::Load(Element* document)
   
     Element* component_element = channel_element->GetElement();
     while (component_element) {
+      size_t nComponents = newChannel->GetNumComponents();
       try {
         if ((component_element->GetName() == string("lag_filter")) ||
             (component_element->GetName() == string("lead_lag_filter")) ||
@@ -583,12 +906,19 @@ bool FGFCS::Load(Element* document)
         cerr << reset << endl;
         return false;
       }
+      if (newChannel->GetNumComponents() > nComponents) {
+        string tmp = newChannel->GetComponent(nComponents)->GetName();
+        if (tmp.find("/") == string::npos)
+          tmp = "fcs/" + PropertyManager->mkPropertyName(tmp, true);
+        access.Owned.push_back(tmp);
+        ScanChannelAccess(component_element, access);
+      }
       component_element = channel_element->GetNextElement();
     }
     channel_element = document->FindNextElement("channel");
   }
 
-  PostLoad(document, PropertyManager);
+  PostLoad(document, FDMExec);
 
   return true;
 }
@@ -741,6 +1071,8 @@ void FGFCS::bind(void)
   PropertyManager->Tie("gear/tailhook-pos-norm", this, &FGFCS::GetTailhookPos, &FGFCS::SetTailhookPos);
   PropertyManager->Tie("fcs/wing-fold-pos-norm", this, &FGFCS::GetWingFoldPos, &FGFCS::SetWingFoldPos);
   PropertyManager->Tie("simulation/channel-dt", this, &FGFCS::GetChannelDeltaT);
+  PropertyManager->Tie("simulation/fcs-threads", this, &FGFCS::GetFCSThreads, &FGFCS::SetFCSThreads);
+  PropertyManager->Tie("simulation/fcs-compiled", this, &FGFCS::GetFCSCompiled, &FGFCS::SetFCSCompiled);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
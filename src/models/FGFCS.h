@@ -61,6 +61,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGFCSChannel;
+class FGThreadPool;
 typedef enum { ofRad=0, ofDeg, ofNorm, ofMag , NForms} OutputForm;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -126,6 +127,37 @@ CLASS DOCUMENTATION
 
     In this case, the FCS would be read in from another file.
 
+    <h2>Parallel execution of the channels</h2>
+
+    When the property simulation/fcs-threads is set to a value other than 1,
+    the channels of all the systems, autopilots and flight controls are
+    executed on a pool of worker threads. The first time the channels are run,
+    the properties read and written by each channel are collected from its
+    definition (inputs, outputs, tests, tables, functions, etc.) and the
+    channels are sorted in stages: a channel is placed in the stage following
+    the last previous channel it shares a property with (one of them writing
+    it). The channels of a stage are independent and run in parallel, the
+    stages are run in sequence, so a chain of dependent channels is executed in
+    the order of the definition just as in serial mode.
+
+    Some channels are conservatively run alone in their stage: channels using
+    noise or random numbers, channels reading simulation/channel-dt or a
+    property that does not exist yet. Channels writing properties managed by
+    other models (for instance fcs/elevator-pos-rad or
+    propulsion/engine/set-running) are serialized with the channels that access
+    the properties managed in the same branch of the property tree.
+
+    <h2>Compiled channels</h2>
+
+    When the property simulation/fcs-compiled is set to 1, each channel is
+    compiled before it is next run (see FGFCSKernel): the gains, summers,
+    filters, PIDs and switches are executed as a flat list of typed
+    operations, and the inputs that are outputs of other components are read
+    directly from them rather than through the property tree. The outputs are
+    still written to the property tree. The results are identical to those of
+    the interpreted execution. The compiled mode takes precedence over
+    simulation/change-driven.
+
     <h2>Properties</h2>
     @property fcs/aileron-cmd-norm normalized aileron command
     @property fcs/elevator-cmd-norm normalized elevator command
@@ -168,6 +200,11 @@ CLASS DOCUMENTATION
     @property fcs/wing-fold-pos-norm
     @property gear/gear-pos-norm
     @property gear/tailhook-pos-norm
+    @property simulation/fcs-threads number of threads executing the channels
+              (1 - the default - for serial execution, 0 for the number of
+              hardware threads)
+    @property simulation/fcs-compiled 1 to execute the channels in compiled
+              form, 0 (the default) to run the components one by one
 
     @author Jon S. Berndt
     @version $Revision: 1.55 $
@@ -556,6 +593,21 @@ public:
   bool GetTrimStatus(void) const { return FDMExec->GetTrimStatus(); }
   double GetChannelDeltaT(void) const { return GetDt() * ChannelRate; }
 
+  /** Sets the number of threads executing the channels.
+      @param n number of threads: 1 for serial execution, 0 for the number of
+               hardware threads. */
+  void SetFCSThreads(int n);
+  int GetFCSThreads(void) const { return FCSThreads; }
+
+  /** Selects the compiled execution of the channels.
+      @param n 1 to compile the channels, 0 to run the components. */
+  void SetFCSCompiled(int n);
+  int GetFCSCompiled(void) const { return FCSCompiled; }
+
+  /** Returns the number of stages of the parallel channel schedule (0 if the
+      schedule has not been built yet). */
+  int GetNumChannelStages(void) const { return (int)ChannelStages.size(); }
+
 private:
   double DaCmd, DeCmd, DrCmd, DfCmd, DsbCmd, DspCmd;
   double DePos[NForms], DaLPos[NForms], DaRPos[NForms], DrPos[NForms];
@@ -579,6 +631,26 @@ private:
 
   typedef std::vector <FGFCSChannel*> Channels;
   Channels SystemChannels;
+
+  /// Properties accessed by a channel, as found in its definition.
+  struct ChannelAccess {
+    std::vector<std::string> Reads;
+    std::vector<std::string> Writes;
+    std::vector<std::string> Owned; // nodes tied by the channel components
+    bool Exclusive;
+    ChannelAccess(void) : Exclusive(false) {}
+  };
+  std::vector<ChannelAccess> ChannelAccesses;
+  std::vector<std::vector<unsigned int> > ChannelStages;
+  int FCSThreads;
+  FGThreadPool* ChannelPool;
+  int FCSCompiled;
+  bool ChannelsCompiled;
+
+  void ScanChannelAccess(Element* el, ChannelAccess& access);
+  void BuildChannelSchedule(void);
+  void RunChannel(unsigned int i);
+  void CompileChannels(void);
   void bind(void);
   void bindThrottle(unsigned int);
   void Debug(int from);
@@ -67,6 +67,9 @@ CLASS DOCUMENTATION
       execrate [optional] is the rate at which the channel should execute. 
                A value of 0 or 1 will execute the channel every frame, a value of 2
                every other frame (half rate), a value of 4 is every 4th frame (quarter rate)
+      essential [optional] "false" marks a channel (instruments, sound, effects,
+               ...) that is not executed when the level of detail of the FDM is
+               reduced (see FGFDMExec::SetLOD). Its outputs keep their last value.
       */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -80,15 +83,18 @@ public:
   /// Constructor
   FGFCSChannel(FGFCS* FCS, const std::string &name, int execRate,
                FGPropertyNode* node=0)
-    : fcs(FCS), OnOffNode(node), Name(name)
+    : fcs(FCS), OnOffNode(node), Name(name), Kernel(0), Essential(true)
   {
     ExecRate = execRate < 1 ? 1 : execRate;
     // Set ExecFrameCountSinceLastRun so that each components are initialized
     ExecFrameCountSinceLastRun = ExecRate;
+    Perf = fcs->GetExec()->GetPerfMonitor();
+    PerfChannel = Perf->GetEntry("fcs", Name);
   }
 
   /// Destructor
   ~FGFCSChannel() {
+    delete Kernel;
     for (unsigned int i=0; i<FCSComponents.size(); i++) delete FCSComponents[i];
     FCSComponents.clear();
   }
@@ -98,6 +104,7 @@ public:
   /// Adds a component to a channel
   void Add(FGFCSComponent* comp) {
     FCSComponents.push_back(comp);
+    PerfComponents.push_back(Perf->GetEntry("fcs/" + Name, comp->GetName()));
     comp->SetDtForFrameCount(ExecRate);
   }
   /// Returns the number of components in the channel.
@@ -111,6 +118,17 @@ public:
       return FCSComponents[i];
     }
   }
+  /// Retrieves the components in execution order.
+  const FCSCompVec& GetComponents(void) const { return FCSComponents; }
+  /** Sets the compiled form of the channel which is then executed in place of
+      the components. The channel takes ownership of the kernel; a null
+      pointer reverts to the execution of the components. */
+  void SetKernel(FGFCSKernel* kernel) {
+    delete Kernel;
+    Kernel = kernel;
+  }
+  /// Retrieves the compiled form of the channel (null if not compiled).
+  FGFCSKernel* GetKernel(void) const { return Kernel; }
   /// Reset the components that can be reset
   void Reset() {
     for (unsigned int i=0; i<FCSComponents.size(); i++)
@@ -120,6 +138,9 @@ public:
     // after a reset.
     ExecFrameCountSinceLastRun = ExecRate;
   }
+  /// Marks the channel as needed at the reduced levels of detail.
+  void SetEssential(bool essential) { Essential = essential; }
+  bool IsEssential(void) const { return Essential; }
   /// Executes all the components in a channel.
   void Execute() {
     // If there is an on/off property supplied for this channel, check
@@ -127,6 +148,8 @@ public:
     // and do not execute the channel.
     if (OnOffNode && !OnOffNode->getBoolValue()) return;
 
+    if (!Essential && fcs->GetExec()->GetLOD() != FGFDMExec::eLODFull) return;
+
     if (fcs->GetDt() != 0.0) {
       if (ExecFrameCountSinceLastRun >= ExecRate) {
         ExecFrameCountSinceLastRun = 0;
@@ -138,8 +161,20 @@ public:
     // channel will be run at rate 1 if trimming, or when the next execrate
     // frame is reached
     if (fcs->GetTrimStatus() || ExecFrameCountSinceLastRun >= ExecRate) {
-      for (unsigned int i=0; i<FCSComponents.size(); i++) 
-        FCSComponents[i]->Run();
+      FGPerfMonitor::Scope channelTimer(Perf, PerfChannel);
+      if (Kernel) {
+        Kernel->Run();
+      } else if (fcs->GetExec()->GetChangeDriven()) {
+        for (unsigned int i=0; i<FCSComponents.size(); i++) {
+          FGPerfMonitor::Scope timer(Perf, PerfComponents[i]);
+          FCSComponents[i]->RunIfChanged();
+        }
+      } else {
+        for (unsigned int i=0; i<FCSComponents.size(); i++) {
+          FGPerfMonitor::Scope timer(Perf, PerfComponents[i]);
+          FCSComponents[i]->Run();
+        }
+      }
     }
   }
   /// Get the channel rate
@@ -150,9 +185,15 @@ public:
     FCSCompVec FCSComponents;
     FGConstPropertyNode_ptr OnOffNode;
     std::string Name;
+    FGFCSKernel* Kernel;
+    bool Essential;
 
     int ExecRate;        // rate at which this system executes, 0 or 1 every frame, 2 every second frame etc..
     int ExecFrameCountSinceLastRun;
+
+    FGPerfMonitor* Perf;
+    FGPerfMonitor::Entry* PerfChannel;
+    std::vector<FGPerfMonitor::Entry*> PerfComponents;
 };
 
 }
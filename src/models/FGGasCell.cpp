@@ -223,7 +223,7 @@ FGGasCell::FGGasCell(FGFDMExec* exec, Element* el, unsigned int num,
   if (Element* heat = el->FindElement("heat")) {
     Element* function_element = heat->FindElement("function");
     while (function_element) {
-      HeatTransferCoeff.push_back(new FGFunction(PropertyManager,
+      HeatTransferCoeff.push_back(new FGFunction(exec,
                                                  function_element));
       function_element = heat->FindNextElement("function");
     }
@@ -361,13 +361,7 @@ void FGGasCell::Calculate(double dt)
     Contents * R * (Temperature / Pressure - OldTemperature / OldPressure);
 
   //-- Current buoyancy --
-  // The buoyancy is computed using the atmospheres local density.
-  Buoyancy = Volume * AirDensity * g;
-  
-  // Note: This is gross buoyancy. The weight of the gas itself and
-  // any ballonets is not deducted here as the effects of the gas mass
-  // is handled by FGMassBalance.
-  vFn.InitMatrix(0.0, 0.0, - Buoyancy);
+  UpdateBuoyancy();
 
   // Compute the inertia of the gas cell.
   // Consider the gas cell as a shape of uniform density.
@@ -430,6 +424,19 @@ void FGGasCell::Calculate(double dt)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGasCell::UpdateBuoyancy(void)
+{
+  // The buoyancy is computed using the atmospheres local density.
+  Buoyancy = Volume * in.Density * in.gravity;
+
+  // Note: This is gross buoyancy. The weight of the gas itself and
+  // any ballonets is not deducted here as the effects of the gas mass
+  // is handled by FGMassBalance.
+  vFn.InitMatrix(0.0, 0.0, - Buoyancy);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -659,7 +666,7 @@ FGBallonet::FGBallonet(FGFDMExec* exec, Element* el, unsigned int num,
   if (Element* heat = el->FindElement("heat")) {
     Element* function_element = heat->FindElement("function");
     while (function_element) {
-      HeatTransferCoeff.push_back(new FGFunction(PropertyManager,
+      HeatTransferCoeff.push_back(new FGFunction(exec,
                                                  function_element));
       function_element = heat->FindNextElement("function");
     }
@@ -667,7 +674,7 @@ FGBallonet::FGBallonet(FGFDMExec* exec, Element* el, unsigned int num,
   // Read blower input function
   if (Element* blower = el->FindElement("blower_input")) {
     Element* function_element = blower->FindElement("function");
-    BlowerInput = new FGFunction(PropertyManager,
+    BlowerInput = new FGFunction(exec,
                                  function_element);
   }
 }
@@ -179,6 +179,7 @@ public:
     double Temperature;
     double Density;
     double gravity;
+    double TotalDeltaT;
   };
 
   /** Constructor
@@ -193,6 +194,11 @@ public:
    */
   void Calculate(double dt);
 
+  /** Updates the buoyancy for the current air density, the volume of the cell
+      being held. Called by BuoyantForces between two executions of
+      Calculate() when the gas cells are run at a lower rate. */
+  void UpdateBuoyancy(void);
+
   /** Get the index of this gas cell
       @return gas cell index. */
   int GetIndex(void) const {return CellNum;}
@@ -171,7 +171,11 @@ bool FGGroundReactions::Load(Element* document)
 
   for (unsigned int i=0; i<lGear.size();i++) lGear[i]->bind();
 
-  PostLoad(document, PropertyManager);
+  // Each contact registers at most 3 multipliers per frame: reserving them
+  // now avoids the growth of the list during the run.
+  multipliers.reserve(3*lGear.size());
+
+  PostLoad(document, FDMExec);
 
   return true;
 }
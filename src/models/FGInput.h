@@ -128,7 +128,9 @@ public:
 
   /// Enables the input generation for all input instances.
   void Enable(void) { enabled = true; }
-  /// Disables the input generation for all input instances.
+  /** Disables the input generation for all input instances. The sockets are
+      not opened when the initial conditions are run while the input
+      generation is disabled. */
   void Disable(void) { enabled = false; }
   /** Toggles the input generation of each input instance.
       @param idx ID of the input instance which input generation will be
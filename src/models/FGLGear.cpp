@@ -115,7 +115,7 @@ FGLGear::FGLGear(Element* el, FGFDMExec* fdmex, int number, const struct Inputs&
   Element* strutForce = el->FindElement("strut_force");
   if (strutForce) {
     Element* springFunc = strutForce->FindElement("function");
-    fStrutForce = new FGFunction(PropertyManager, springFunc);
+    fStrutForce = new FGFunction(fdmex, springFunc);
   }
   else {
     if (el->FindElement("spring_coeff"))
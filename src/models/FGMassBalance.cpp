@@ -41,6 +41,7 @@ INCLUDES
 #include <iostream>
 #include <iomanip>
 #include <cstdlib>
+#include <cmath>
 
 #include "FGMassBalance.h"
 #include "FGFDMExec.h"
@@ -72,6 +73,11 @@ FGMassBalance::FGMassBalance(FGFDMExec* fdmex) : FGModel(fdmex)
   mJ.InitMatrix();
   mJinv.InitMatrix();
   pmJ.InitMatrix();
+  PointMassCG.InitMatrix();
+  PointMassWeight = 0.0;
+  WeightTolerance = CGTolerance = 0.0;
+  Dirty = PointMassesDirty = true;
+  LastChildFDMWeight = 0.0;
 
   bind();
 
@@ -96,6 +102,7 @@ bool FGMassBalance::InitModel(void)
 
   vLastXYZcg.InitMatrix(0.0);
   vDeltaXYZcg.InitMatrix(0.0);
+  Dirty = true;
 
   return true;
 }
@@ -167,8 +174,9 @@ bool FGMassBalance::Load(Element* document)
     + in.GasMass*slugtolb + ChildFDMWeight;
 
   Mass = lbtoslug*Weight;
+  Dirty = PointMassesDirty = true;
 
-  PostLoad(document, PropertyManager);
+  PostLoad(document, FDMExec);
 
   Debug(2);
   return true;
@@ -191,7 +199,30 @@ bool FGMassBalance::Run(bool Holding)
     if (FDMExec->GetChildFDM(fdm)->mated) ChildFDMWeight += FDMExec->GetChildFDM(fdm)->exec->GetMassBalance()->GetWeight();
   }
 
-  Weight = EmptyWeight + in.TanksWeight + GetTotalPointMassWeight()
+  if (PointMassesDirty) {
+    PointMassWeight = GetTotalPointMassWeight();
+    GetPointMassMoment();
+    PointMassesDirty = false;
+    Dirty = true;
+  }
+
+  // The mass properties are kept as long as their contributors are unchanged.
+  if (!Dirty && !InputsChanged(ChildFDMWeight)) {
+    vDeltaXYZcg.InitMatrix();
+    vDeltaXYZcgBody.InitMatrix();
+
+    RunPostFunctions();
+
+    Debug(0);
+
+    return false;
+  }
+
+  Dirty = false;
+  LastInputs = in;
+  LastChildFDMWeight = ChildFDMWeight;
+
+  Weight = EmptyWeight + in.TanksWeight + PointMassWeight
     + in.GasMass*slugtolb + ChildFDMWeight;
 
   Mass = lbtoslug*Weight;
@@ -199,7 +230,7 @@ bool FGMassBalance::Run(bool Holding)
 // Calculate new CG
 
   vXYZcg = (EmptyWeight*vbaseXYZcg
-            + GetPointMassMoment()
+            + PointMassCG
             + in.TanksMoment
             + in.GasMoment) / Weight;
 
@@ -254,6 +285,31 @@ bool FGMassBalance::Run(bool Holding)
   return false;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Without tolerances, any change of the inputs triggers the update. Otherwise
+// only the resulting weight and CG are compared to the last update.
+
+bool FGMassBalance::InputsChanged(double ChildFDMWeight) const
+{
+  if (WeightTolerance > 0.0 || CGTolerance > 0.0) {
+    double weight = EmptyWeight + in.TanksWeight + PointMassWeight
+      + in.GasMass*slugtolb + ChildFDMWeight;
+    FGColumnVector3 cg = (EmptyWeight*vbaseXYZcg + PointMassCG + in.TanksMoment
+                          + in.GasMoment) / weight;
+
+    return fabs(weight - Weight) > WeightTolerance
+      || (cg - vXYZcg).Magnitude() > CGTolerance;
+  }
+
+  return ChildFDMWeight != LastChildFDMWeight
+    || in.TanksWeight != LastInputs.TanksWeight
+    || in.TanksMoment != LastInputs.TanksMoment
+    || in.TankInertia != LastInputs.TankInertia
+    || in.GasMass != LastInputs.GasMass
+    || in.GasMoment != LastInputs.GasMoment
+    || in.GasInertia != LastInputs.GasInertia;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGMassBalance::AddPointMass(Element* el)
@@ -269,7 +325,7 @@ void FGMassBalance::AddPointMass(Element* el)
   double w = el->FindElementValueAsNumberConvertTo("weight", "LBS");
   FGColumnVector3 vXYZ = loc_element->FindElementTripletConvertTo("IN");
 
-  PointMass *pm = new PointMass(w, vXYZ);
+  PointMass *pm = new PointMass(w, vXYZ, &PointMassesDirty);
   pm->SetName(pointmass_name);
 
   Element* form_element = el->FindElement("form");
@@ -308,6 +364,7 @@ void FGMassBalance::AddPointMass(Element* el)
 
   pm->bind(PropertyManager, PointMasses.size());
   PointMasses.push_back(pm);
+  PointMassesDirty = true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -414,6 +471,8 @@ void FGMassBalance::bind(void)
                        &FGMassBalance::GetIxz);
   PropertyManager->Tie("inertia/iyz-slugs_ft2", this,
                        &FGMassBalance::GetIyz);
+  PropertyManager->Tie("inertia/weight-tolerance-lbs", &WeightTolerance);
+  PropertyManager->Tie("inertia/cg-tolerance-in", &CGTolerance);
   typedef int (FGMassBalance::*iOPV)() const;
   PropertyManager->Tie("inertia/print-mass-properties", this, (iOPV)0,
                        &FGMassBalance::GetMassPropertiesReport, false);
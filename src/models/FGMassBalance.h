@@ -100,6 +100,27 @@ CLASS DOCUMENTATION
         ... other point masses ...]
     </mass_balance>
 @endcode
+
+    <h3>Incremental update:</h3>
+
+    The weight, CG and inertia tensor (and its inverse) are only recomputed
+    when one of their contributors has changed: empty weight, base CG or
+    inertias, point masses, tanks, gas cells or mated child FDMs. The sums over
+    the point masses are only redone when a point mass has been modified.
+
+    By default any change triggers the update, so the results are the same as
+    if the mass properties were recomputed every frame. The update of slowly
+    varying contributors such as fuel burn can be deferred by setting the
+    properties inertia/weight-tolerance-lbs and inertia/cg-tolerance-in: the
+    mass properties are then only recomputed when the weight or the CG has
+    moved by more than these tolerances since the last update, or when a point
+    mass or the base configuration has been modified.
+
+    <h3>Properties:</h3>
+    @property inertia/weight-tolerance-lbs change of weight below which the mass
+              properties are not recomputed (0 by default)
+    @property inertia/cg-tolerance-in displacement of the CG below which the
+              mass properties are not recomputed (0 by default)
   */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -166,8 +187,8 @@ public:
    */
   FGColumnVector3 StructuralToBody(const FGColumnVector3& r) const;
 
-  void SetEmptyWeight(double EW) { EmptyWeight = EW;}
-  void SetBaseCG(const FGColumnVector3& CG) {vbaseXYZcg = vXYZcg = CG;}
+  void SetEmptyWeight(double EW) { EmptyWeight = EW; Dirty = true; }
+  void SetBaseCG(const FGColumnVector3& CG) {vbaseXYZcg = vXYZcg = CG; Dirty = true;}
 
   void AddPointMass(Element* el);
   double GetTotalPointMassWeight(void) const;
@@ -175,7 +196,7 @@ public:
   const FGColumnVector3& GetPointMassMoment(void);
   const FGMatrix33& GetJ(void) const {return mJ;}
   const FGMatrix33& GetJinv(void) const {return mJinv;}
-  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {baseJ = BaseJ;}
+  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {baseJ = BaseJ; Dirty = true;}
   void GetMassPropertiesReport(int i);
   
   struct Inputs {
@@ -203,7 +224,15 @@ private:
   FGColumnVector3 vbaseXYZcg;
   FGColumnVector3 vPMxyz;
   FGColumnVector3 PointMassCG;
+  double PointMassWeight;
+  double WeightTolerance;
+  double CGTolerance;
+  bool Dirty;             // Mass properties must be recomputed
+  bool PointMassesDirty;  // A point mass has been modified
+  Inputs LastInputs;      // Inputs of the last update
+  double LastChildFDMWeight;
   const FGMatrix33& CalculatePMInertias(void);
+  bool InputsChanged(double ChildFDMWeight) const;
   double GetIxx(void) const { return mJ(1,1); }
   double GetIyy(void) const { return mJ(2,2); }
   double GetIzz(void) const { return mJ(3,3); }
@@ -214,7 +243,8 @@ private:
   /** The PointMass structure encapsulates a point mass object, moments of inertia
      mass, location, etc. */
   struct PointMass {
-    PointMass(double w, FGColumnVector3& vXYZ) {
+    PointMass(double w, FGColumnVector3& vXYZ, bool* changed) {
+      Changed = changed;
       Weight = w;
       Location = vXYZ;
       mPMInertia.InitMatrix();
@@ -256,6 +286,7 @@ private:
     double Length; /// Length in feet.
     std::string Name;
     FGMatrix33 mPMInertia;
+    bool* Changed; /// Flag raised when the point mass is modified.
 
     double GetPointMassLocation(int axis) const {return Location(axis);}
     double GetPointMassWeight(void) const {return Weight;}
@@ -264,16 +295,20 @@ private:
     const FGMatrix33& GetPointMassInertia(void) {return mPMInertia;}
     const std::string& GetName(void) {return Name;}
 
-    void SetPointMassLocation(int axis, double value) {Location(axis) = value;}
+    void SetPointMassLocation(int axis, double value) {
+      Location(axis) = value;
+      *Changed = true;
+    }
     void SetPointMassWeight(double wt) {
       Weight = wt;
       CalculateShapeInertia();
+      *Changed = true;
     }
     void SetPointMassShapeType(esShape st) {eShapeType = st;}
     void SetRadius(double r) {Radius = r;}
     void SetLength(double l) {Length = l;}
     void SetName(const std::string& name) {Name = name;}
-    void SetPointMassMoI(const FGMatrix33& MoI) { mPMInertia = MoI; }
+    void SetPointMassMoI(const FGMatrix33& MoI) { mPMInertia = MoI; *Changed = true; }
     double GetPointMassMoI(int r, int c) {return mPMInertia(r,c);}
 
     void bind(FGPropertyManager* PropertyManager, unsigned int num);
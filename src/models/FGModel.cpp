@@ -124,7 +124,7 @@ bool FGModel::Load(Element* el)
     return false;
   }
 
-  bool result = FGModelFunctions::Load(document, PropertyManager);
+  bool result = FGModelFunctions::Load(document, FDMExec);
 
   if (document != el) {
     el->MergeAttributes(document);
@@ -91,6 +91,9 @@ bool FGOutput::InitModel(void)
 
   if (!FGModel::InitModel()) return false;
 
+  // Disabled outputs (clones, Monte Carlo cases, ...) do not create any file.
+  if (!enabled) return ret;
+
   vector<FGOutputType*>::iterator it;
   for (it = OutputTypes.begin(); it != OutputTypes.end(); ++it)
     ret &= (*it)->InitModel();
@@ -258,7 +261,7 @@ bool FGOutput::Load(Element* el)
 
   if (!element) return false;
 
-  FGModel::PreLoad(element, PropertyManager);
+  FGModel::PreLoad(element, FDMExec);
 
   size_t idx = OutputTypes.size();
   string type = element->GetAttributeValue("type");
@@ -288,7 +291,7 @@ bool FGOutput::Load(Element* el)
 
   Output->SetIdx(idx);
   Output->Load(element);
-  PostLoad(element, PropertyManager);
+  PostLoad(element, FDMExec);
 
   OutputTypes.push_back(Output);
 
@@ -186,7 +186,9 @@ public:
   bool SetDirectivesFile(const SGPath& fname);
   /// Enables the output generation for all output instances.
   void Enable(void) { enabled = true; }
-  /// Disables the output generation for all output instances.
+  /** Disables the output generation for all output instances. The output
+      files are not created when the initial conditions are run while the
+      output generation is disabled. */
   void Disable(void) { enabled = false; }
   /** Toggles the output generation of each ouput instance.
       @param idx ID of the output instance which output generation will be
@@ -327,8 +327,10 @@ void FGPropagate::Integrate( FGColumnVector3& Integrand,
                              double dt,
                              eIntegrateType integration_type)
 {
-  ValDot.push_front(Val);
-  ValDot.pop_back();
+  // The history is shifted in place: push_front() and pop_back() would
+  // allocate and free the blocks of the deque as they move through memory.
+  for (size_t i=ValDot.size()-1; i>0; i--) ValDot[i] = ValDot[i-1];
+  ValDot[0] = Val;
 
   switch(integration_type) {
   case eRectEuler:       Integrand += dt*ValDot[0];
@@ -362,8 +364,10 @@ void FGPropagate::Integrate( FGQuaternion& Integrand,
                              double dt,
                              eIntegrateType integration_type)
 {
-  ValDot.push_front(Val);
-  ValDot.pop_back();
+  // The history is shifted in place: push_front() and pop_back() would
+  // allocate and free the blocks of the deque as they move through memory.
+  for (size_t i=ValDot.size()-1; i>0; i--) ValDot[i] = ValDot[i-1];
+  ValDot[0] = Val;
 
   switch(integration_type) {
   case eRectEuler:       Integrand += dt*ValDot[0];
@@ -93,6 +93,7 @@ FGPropulsion::FGPropulsion(FGFDMExec* exec) : FGModel(exec)
   HaveRocketEngine =
   HaveTurboPropEngine =
   HaveElectricEngine = false;
+  in.PerformanceMode = false;
 
   Debug(0);
 }
@@ -103,6 +104,7 @@ FGPropulsion::~FGPropulsion()
 {
   for (unsigned int i=0; i<Engines.size(); i++) delete Engines[i];
   Engines.clear();
+  EnginesPerf.clear();
   for (unsigned int i=0; i<Tanks.size(); i++) delete Tanks[i];
   Tanks.clear();
   Debug(1);
@@ -144,8 +146,12 @@ bool FGPropulsion::Run(bool Holding)
   vForces.InitMatrix();
   vMoments.InitMatrix();
 
+  FGPerfMonitor* perf = FDMExec->GetPerfMonitor();
   for (i=0; i<numEngines; i++) {
-    Engines[i]->Calculate();
+    {
+      FGPerfMonitor::Scope timer(perf, EnginesPerf[i]);
+      Engines[i]->Calculate();
+    }
     ConsumeFuel(Engines[i]);
     vForces  += Engines[i]->GetBodyForces();  // sum body frame forces
     vMoments += Engines[i]->GetMoments();     // sum body frame moments
@@ -192,7 +198,8 @@ void FGPropulsion::ConsumeFuel(FGEngine* engine)
 
   unsigned int TanksWithFuel=0, CurrentFuelTankPriority=1;
   unsigned int TanksWithOxidizer=0, CurrentOxidizerTankPriority=1;
-  vector <int> FeedListFuel, FeedListOxi;
+  FeedListFuel.clear();
+  FeedListOxi.clear();
   bool Starved = true; // Initially set Starved to true. Set to false in code below.
   bool hasOxTanks = false;
 
@@ -438,6 +445,7 @@ bool FGPropulsion::Load(Element* el)
       return false;
     }
 
+    EnginesPerf.push_back(FDMExec->GetPerfMonitor()->GetEntry("propulsion", "engine", numEngines));
     numEngines++;
 
     engine_element = el->FindNextElement("engine");
@@ -456,7 +464,7 @@ bool FGPropulsion::Load(Element* el)
   }
 
 
-  PostLoad(el, PropertyManager);
+  PostLoad(el, FDMExec);
 
   return true;
 }
@@ -589,6 +597,33 @@ const FGMatrix33& FGPropulsion::CalculateTankInertias(void)
 
   if (size == 0) return tankJ;
 
+  // The inertias only need to be summed again if a tank or the CG has moved
+  // or if the contents or the shape of a tank has changed.
+  const FGColumnVector3& vXYZcg = FDMExec->GetMassBalance()->GetXYZcg();
+  bool changed = TankStates.size() != size || vXYZcg != TankInertiaCG;
+
+  TankStates.resize(size);
+  for (unsigned int i=0; i<size; i++) {
+    TankState& state = TankStates[i];
+    FGTank* tank = Tanks[i];
+    double contents = tank->GetContents();
+    FGColumnVector3 vXYZ = tank->GetXYZ();
+
+    if (changed || state.Contents != contents || state.XYZ != vXYZ
+        || state.Ixx != tank->GetIxx() || state.Iyy != tank->GetIyy()
+        || state.Izz != tank->GetIzz()) {
+      state.Contents = contents;
+      state.XYZ = vXYZ;
+      state.Ixx = tank->GetIxx();
+      state.Iyy = tank->GetIyy();
+      state.Izz = tank->GetIzz();
+      changed = true;
+    }
+  }
+
+  if (!changed) return tankJ;
+
+  TankInertiaCG = vXYZcg;
   tankJ = FGMatrix33();
 
   for (unsigned int i=0; i<size; i++) {
@@ -45,6 +45,7 @@ INCLUDES
 #include "FGModel.h"
 #include "propulsion/FGEngine.h"
 #include "math/FGMatrix33.h"
+#include "FGPerfMonitor.h"
 
 #include "JSBSim_api.h"
 
@@ -197,6 +198,8 @@ public:
 
 private:
   std::vector <FGEngine*>   Engines;
+  std::vector <FGPerfMonitor::Entry*> EnginesPerf;
+  std::vector <int> FeedListFuel, FeedListOxi; // work lists of ConsumeFuel()
   std::vector <FGTank*>     Tanks;
   unsigned int numSelectedFuelTanks;
   unsigned int numSelectedOxiTanks;
@@ -210,6 +213,14 @@ private:
   FGColumnVector3 vTankXYZ;
   FGColumnVector3 vXYZtank_arm;
   FGMatrix33 tankJ;
+  /// State of a tank when tankJ was last computed.
+  struct TankState {
+    double Contents;
+    FGColumnVector3 XYZ;
+    double Ixx, Iyy, Izz;
+  };
+  std::vector<TankState> TankStates;
+  FGColumnVector3 TankInertiaCG; // CG when tankJ was last computed
   simgear::PropertyObject<bool> refuel;
   simgear::PropertyObject<bool> dump;
   bool FuelFreeze;
@@ -59,6 +59,7 @@ INCLUDES
 
 #include "FGMSIS.h"
 #include "models/FGAuxiliary.h"
+#include <algorithm>
 #include <cmath>          /* maths functions */
 #include <iostream>        // for cout, endl
 
@@ -92,7 +93,75 @@ CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 
-MSIS::MSIS(FGFDMExec* fdmex) : FGAtmosphere(fdmex)
+std::mutex MSISCache::RegistryMutex;
+std::map<MSISCache::Key, MSISCache*> MSISCache::Registry;
+
+// Packs the indices of a node of the grid in a single integer.
+static long long GridIndex(int ialt, int ilat, int ilst)
+{
+  return ((long long)(ialt + 0x100000) << 32) | ((long long)ilat << 16) | ilst;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool MSISCache::Key::operator<(const Key& k) const
+{
+  if (doy != k.doy) return doy < k.doy;
+  if (sec != k.sec) return sec < k.sec;
+  if (f107A != k.f107A) return f107A < k.f107A;
+  if (f107 != k.f107) return f107 < k.f107;
+  if (ap != k.ap) return ap < k.ap;
+  if (altStep != k.altStep) return altStep < k.altStep;
+  if (latStep != k.latStep) return latStep < k.latStep;
+  return lstStep < k.lstStep;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+MSISCache* MSISCache::Acquire(const Key& key)
+{
+  lock_guard<mutex> lock(RegistryMutex);
+  MSISCache*& cache = Registry[key];
+  if (!cache) cache = new MSISCache(key);
+  cache->refcount++;
+  return cache;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void MSISCache::Release(MSISCache* cache)
+{
+  if (!cache) return;
+
+  lock_guard<mutex> lock(RegistryMutex);
+  if (--cache->refcount == 0) {
+    Registry.erase(cache->key);
+    delete cache;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool MSISCache::GetNode(long long index, Node& node) const
+{
+  lock_guard<mutex> lock(Mutex);
+  map<long long, Node>::const_iterator it = Nodes.find(index);
+  if (it == Nodes.end()) return false;
+  node = it->second;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void MSISCache::SetNode(long long index, const Node& node)
+{
+  lock_guard<mutex> lock(Mutex);
+  Nodes[index] = node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+MSIS::MSIS(FGFDMExec* fdmex) : FGAtmosphere(fdmex), Cache(0), CellIndex(-1)
 {
   Name = "MSIS";
 
@@ -108,6 +177,8 @@ MSIS::MSIS(FGFDMExec* fdmex) : FGAtmosphere(fdmex)
   for (int i=0; i<2; i++) meso_tgn2[i] = 0.0;
   for (int i=0; i<2; i++) meso_tgn3[i] = 0.0;
 
+  SetCache(300.0);
+
   Debug(0);
 }
 
@@ -115,6 +186,7 @@ MSIS::MSIS(FGFDMExec* fdmex) : FGAtmosphere(fdmex)
 
 MSIS::~MSIS()
 {
+  MSISCache::Release(Cache);
   Debug(1);
 }
 
@@ -202,6 +274,11 @@ bool MSIS::Run(bool Holding)
 
 void MSIS::Calculate(int day, double sec, double alt, double lat, double lon)
 {
+  if (CacheRefresh > 0.0) {
+    CalculateCached(day, sec, alt, lat, lon);
+    return;
+  }
+
   input.year = 2000;
   input.doy = day;
   input.sec = sec;
@@ -211,7 +288,7 @@ void MSIS::Calculate(int day, double sec, double alt, double lat, double lon)
 
   input.lst = (sec/3600) + (lon/15);
   if (input.lst > 24.0) input.lst -= 24.0;
-  if (input.lst < 0.0) input.lst = 24 - input.lst;
+  if (input.lst < 0.0) input.lst += 24.0;
 
   gtd7d(&input, &flags, &output);
 }
@@ -219,6 +296,114 @@ void MSIS::Calculate(int day, double sec, double alt, double lat, double lon)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 
+// Only the temperature at altitude (t[1]) and the total mass density (d[5])
+// of the output are interpolated. The density is interpolated in logarithm as
+// it decreases exponentially with the altitude.
+
+void MSIS::CalculateCached(int day, double sec, double alt, double lat, double lon)
+{
+  MSISCache::Key key = CacheKey;
+  key.doy = day;
+  key.sec = floor(sec/CacheRefresh)*CacheRefresh;
+  key.f107A = input.f107A;
+  key.f107 = input.f107;
+  key.ap = input.ap;
+
+  if (!Cache || !(Cache->GetKey() == key)) {
+    MSISCache::Release(Cache);
+    Cache = MSISCache::Acquire(key);
+    CellIndex = -1;
+  }
+
+  int nlat = (int)(180.0/key.latStep + 0.5);
+  int nlst = (int)(24.0/key.lstStep + 0.5);
+  double lst = (sec/3600) + (lon/15);
+  lst -= 24.0*floor(lst/24.0);
+
+  double x = alt/3281/key.altStep;
+  double y = (lat + 90.0)/key.latStep;
+  double z = lst/key.lstStep;
+  int ialt = (int)floor(x);
+  int ilat = (int)floor(y);
+  int ilst = (int)floor(z);
+  double fx = x - ialt, fy = y - ilat, fz = z - ilst;
+  if (ilat >= nlat) { ilat = nlat-1; fy = 1.0; }
+  if (ilst >= nlst) { ilst = nlst-1; fz = 1.0; }
+
+  long long cell = GridIndex(ialt, ilat, ilst);
+  if (cell != CellIndex) {
+    for (int i=0; i<8; i++) {
+      int ia = ialt + (i & 1);
+      int il = ilat + ((i >> 1) & 1);
+      int is = (ilst + ((i >> 2) & 1)) % nlst;
+      long long index = GridIndex(ia, il, is);
+      if (!Cache->GetNode(index, CellNodes[i])) {
+        CalculateNode(key, ia, il, is, CellNodes[i]);
+        Cache->SetNode(index, CellNodes[i]);
+      }
+    }
+    CellIndex = cell;
+  }
+
+  double t[4], logd[4];
+  for (int i=0; i<4; i++) {
+    const MSISCache::Node& n0 = CellNodes[2*i];
+    const MSISCache::Node& n1 = CellNodes[2*i+1];
+    t[i] = n0.t + fx*(n1.t - n0.t);
+    logd[i] = n0.logd + fx*(n1.logd - n0.logd);
+  }
+  for (int i=0; i<2; i++) {
+    t[i] = t[2*i] + fy*(t[2*i+1] - t[2*i]);
+    logd[i] = logd[2*i] + fy*(logd[2*i+1] - logd[2*i]);
+  }
+
+  output.t[1] = t[0] + fz*(t[1] - t[0]);
+  output.d[5] = exp(logd[0] + fz*(logd[1] - logd[0]));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void MSIS::CalculateNode(const MSISCache::Key& key, int ialt, int ilat, int ilst,
+                         MSISCache::Node& node)
+{
+  input.year = 2000;
+  input.doy = key.doy;
+  input.sec = key.sec;
+  input.alt = ialt*key.altStep;
+  input.g_lat = -90.0 + ilat*key.latStep;
+  input.lst = ilst*key.lstStep;
+
+  // All the nodes are evaluated at the same time of day so the longitude
+  // follows from the local solar time.
+  double lon = 15.0*(input.lst - key.sec/3600);
+  input.g_long = lon - 360.0*floor((lon + 180.0)/360.0);
+
+  gtd7d(&input, &flags, &output);
+
+  node.t = output.t[1];
+  node.logd = log(output.d[5]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void MSIS::SetCache(double refresh, double altStep, double latStep,
+                    double lstStep)
+{
+  int nlat = max(1, (int)(180.0/latStep + 0.5));
+  int nlst = max(1, (int)(24.0/lstStep + 0.5));
+
+  CacheRefresh = refresh;
+  CacheKey.altStep = altStep;
+  CacheKey.latStep = 180.0/nlat;
+  CacheKey.lstStep = 24.0/nlst;
+
+  MSISCache::Release(Cache);
+  Cache = 0;
+  CellIndex = -1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void MSIS::UseExternal(void){
   // do nothing, external control not allowed
 }
@@ -40,6 +40,8 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <map>
+#include <mutex>
 #include "models/FGAtmosphere.h"
 #include "FGFDMExec.h"
 
@@ -76,6 +78,27 @@ CLASS DOCUMENTATION
     reach him at devel@brodo.de. See the file "DOCUMENTATION" for details,
     and check http://www.brodo.de/english/pub/nrlmsise/index.html for
     updated releases of this package.
+
+    Since the evaluation of the model is expensive and its inputs vary slowly
+    compared to the frame rate, the temperature and the total mass density
+    are by default interpolated in a grid of altitude, latitude and local
+    solar time (see MSISCache). The grid is computed lazily: a node is only
+    evaluated the first time the aircraft flies next to it. The grid is
+    computed for a given day and time of day and is discarded once the time
+    of day has advanced by the refresh interval. SetCache() configures the
+    refresh interval and the spacing of the grid, and disables the cache.
+    With the default settings (300 s, 1 km, 2.5 deg and 0.5 hour), the cached
+    values stay within 0.2% of the temperature and 0.3% of the density
+    evaluated by the model along a re-entry trajectory, and within 0.3% and
+    0.7% anywhere between 20 and 300 km.
+
+    The cache is not interpolated in time: the nodes of a grid are evaluated at
+    the time of day at which the grid was created, so the effects of the
+    universal time (other than through the local solar time) are held for the
+    refresh interval and the values step when the grid is refreshed. With the
+    default settings, the step stays below 0.25% of the temperature and of the
+    density. A host which needs smooth values sets a shorter refresh interval
+    or disables the cache.
     @author David Culp
     @version $Id: FGMSIS.h,v 1.9 2011/05/20 03:18:36 jberndt Exp $
 */
@@ -228,6 +251,66 @@ struct nrlmsise_output {
 CLASS DECLARATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+/** Grid of MSIS temperatures and densities shared by the MSIS instances.
+    The nodes of the grid are evenly spaced in altitude, latitude and local
+    solar time and are all evaluated at the same day and time of day. The
+    longitude of a node is therefore given by its local solar time. A cache is
+    identified by these inputs (its Key) and is shared by all the MSIS
+    instances that use the same inputs: the nodes evaluated by one instance are
+    reused by the others. */
+
+class JSBSIM_API MSISCache
+{
+public:
+  /// Inputs for which the nodes of a cache are evaluated.
+  struct Key {
+    int doy;          // day of year
+    double sec;       // seconds in day (UT)
+    double f107A;     // 81 day average of F10.7 flux
+    double f107;      // daily F10.7 flux for previous day
+    double ap;        // daily magnetic index
+    double altStep;   // altitude spacing (km)
+    double latStep;   // latitude spacing (deg)
+    double lstStep;   // local solar time spacing (hours)
+
+    bool operator<(const Key& k) const;
+    bool operator==(const Key& k) const { return !(*this < k) && !(k < *this); }
+  };
+
+  /// Temperature (K) and logarithm of the total mass density (g/cm3).
+  struct Node {
+    double t;
+    double logd;
+  };
+
+  /** Returns the cache for the given inputs, creating it if needed. The cache
+      must be released with Release(). */
+  static MSISCache* Acquire(const Key& key);
+  /// Releases a cache. The cache is deleted when no MSIS instance uses it.
+  static void Release(MSISCache* cache);
+
+  const Key& GetKey(void) const { return key; }
+
+  /** Looks up a node of the grid.
+      @param index index of the node
+      @param node receives the node if it has been evaluated
+      @return true if the node has been evaluated */
+  bool GetNode(long long index, Node& node) const;
+  /// Stores a node of the grid.
+  void SetNode(long long index, const Node& node);
+
+private:
+  MSISCache(const Key& k) : key(k), refcount(0) {}
+
+  Key key;
+  unsigned int refcount;
+  mutable std::mutex Mutex;
+  std::map<long long, Node> Nodes;
+
+  static std::mutex RegistryMutex;
+  static std::map<Key, MSISCache*> Registry;
+};
+
 class JSBSIM_API MSIS : public FGAtmosphere
 {
 public:
@@ -250,7 +333,19 @@ public:
   /// Does nothing. External control is not allowed.
   void UseExternal(void);
 
-private:
+  /** Configures the cache of the temperature and the density. The cache is
+      discarded when the configuration changes.
+      @param refresh time of day interval (seconds) after which the cached
+                     values are evaluated again, 0 disables the cache
+      @param altStep altitude spacing of the grid (km)
+      @param latStep latitude spacing of the grid (deg), rounded so that it
+                     divides 180
+      @param lstStep local solar time spacing of the grid (hours), rounded so
+                     that it divides 24 */
+  void SetCache(double refresh, double altStep = 1.0, double latStep = 2.5,
+                double lstStep = 0.5);
+
+protected:
 
   void Calculate(int day,      // day of year (1 to 366) 
                  double sec,   // seconds in day (0.0 to 86400.0)
@@ -259,11 +354,26 @@ private:
                  double lon    // geodetic longitude, degrees
                 );
 
-  void Debug(int from);
+  /// Interpolates the temperature and the total mass density in the cache.
+  void CalculateCached(int day, double sec, double alt, double lat, double lon);
+  /// Evaluates the node ialt, ilat, ilst of the grid described by key.
+  void CalculateNode(const MSISCache::Key& key, int ialt, int ilat, int ilst,
+                     MSISCache::Node& node);
+
+  double CacheRefresh;
+  MSISCache::Key CacheKey;
+  MSISCache* Cache;
+  long long CellIndex;
+  MSISCache::Node CellNodes[8];
 
   nrlmsise_flags flags;
   nrlmsise_input input;
   nrlmsise_output output;
+
+private:
+
+  void Debug(int from);
+
   ap_array aph;
 
   /* PARMB */
@@ -53,13 +53,18 @@ namespace JSBSim {
 IDENT(IdSrc,"$Id: FGStandardAtmosphere.cpp,v 1.24 2014/05/17 15:07:48 jberndt Exp $");
 IDENT(IdHdr,ID_STANDARDATMOSPHERE);
 
+// Spacing of the pressure profile in feet of geopotential altitude
+static const double ProfileSpacing = 250.0;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 FGStandardAtmosphere::FGStandardAtmosphere(FGFDMExec* fdmex) : FGAtmosphere(fdmex),
                                                                TemperatureBias(0.0),
-                                                               TemperatureDeltaGradient(0.0)
+                                                               TemperatureDeltaGradient(0.0),
+                                                               PressureProfileTop(0.0),
+                                                               PressureProfileStaleRuns(0)
 {
   Name = "FGStandardAtmosphere";
 
@@ -125,6 +130,7 @@ bool FGStandardAtmosphere::InitModel(void)
   TemperatureBias = 0.0;
   CalculateLapseRates();
   CalculatePressureBreakpoints();
+  CalculatePressureProfile();
   Calculate(0.0);
   StdSLtemperature = SLtemperature = Temperature;
   SLpressure = Pressure;
@@ -141,12 +147,50 @@ bool FGStandardAtmosphere::InitModel(void)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Regenerating the profile costs about as much as evaluating the layer
+// equations once per interval. Waiting for that many runs before regenerating a
+// stale profile therefore bounds the extra cost to a factor of two, however
+// often the profile is modified.
+
+bool FGStandardAtmosphere::Run(bool Holding)
+{
+  if (!Holding && PressureProfileTop == 0.0
+      && ++PressureProfileStaleRuns >= PressureProfile.size())
+    CalculatePressureProfile();
+
+  return FGAtmosphere::Run(Holding);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Get the actual pressure as modeled at a specified altitude
 // These calculations are from equations 33a and 33b in the U.S. Standard Atmosphere
 // document referenced in the documentation for this code.
 
 double FGStandardAtmosphere::GetPressure(double altitude) const
+{
+  double GeoPotAlt = (altitude*20855531.5)/(20855531.5+altitude);
+
+  if (GeoPotAlt >= 0.0 && GeoPotAlt < PressureProfileTop) {
+    double x = GeoPotAlt / ProfileSpacing;
+    unsigned int i = (unsigned int)x;
+    if (!PressureProfileBreak[i]) {
+      const ProfileInterval& p = PressureProfile[i];
+      double t = x - i;
+      return p.c0 + t*(p.c1 + t*(p.c2 + t*(p.c3 + t*(p.c4 + t*p.c5))));
+    }
+  }
+
+  double dPdh, d2Pdh2;
+  return CalculatePressure(GeoPotAlt, dPdh, d2Pdh2);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// These calculations are from equations 33a and 33b in the U.S. Standard Atmosphere
+// document referenced in the documentation for this code.
+
+double FGStandardAtmosphere::CalculatePressure(double GeoPotAlt, double& dPdh,
+                                               double& d2Pdh2) const
 {
   unsigned int b=0;
   double pressure = 0.0;
@@ -159,7 +203,6 @@ double FGStandardAtmosphere::GetPressure(double altitude) const
   // passed-in altitude is 40000 ft, the base altitude is 36089.2388 ft (and
   // the index "b" is 2 - the second entry in the table).
   double testAlt = (*StdAtmosTemperatureTable)(b+1,0);
-  double GeoPotAlt = (altitude*20855531.5)/(20855531.5+altitude);
   while ((GeoPotAlt >= testAlt) && (b <= numRows-2)) {
     b++;
     testAlt = (*StdAtmosTemperatureTable)(b+1,0);
@@ -175,8 +218,12 @@ double FGStandardAtmosphere::GetPressure(double altitude) const
     Exp = Mair/(Rstar*Lmb);
     factor = Tmb/(Tmb + Lmb*deltaH);
     pressure = PressureBreakpointVector[b]*pow(factor, Exp);
+    dPdh = -pressure*Mair/(Rstar*(Tmb + Lmb*deltaH));
+    d2Pdh2 = -Mair*(dPdh - pressure*Lmb/(Tmb + Lmb*deltaH))/(Rstar*(Tmb + Lmb*deltaH));
   } else {
     pressure = PressureBreakpointVector[b]*exp(-Mair*deltaH/(Rstar*Tmb));
+    dPdh = -pressure*Mair/(Rstar*Tmb);
+    d2Pdh2 = -dPdh*Mair/(Rstar*Tmb);
   }
 
   return pressure;
@@ -188,6 +235,8 @@ void FGStandardAtmosphere::SetPressureSL(ePressure unit, double pressure)
 {
   double press = ConvertToPSF(pressure, unit);
 
+  if (press == PressureBreakpointVector[0]) return;
+
   PressureBreakpointVector[0] = press;
   CalculatePressureBreakpoints();
 }
@@ -295,9 +344,12 @@ double FGStandardAtmosphere::GetStdDensity(double altitude) const
 void FGStandardAtmosphere::SetTemperature(double t, double h, eTemperature unit)
 {
   double targetSLtemp = ConvertToRankine(t, unit);
+  double OldBias = TemperatureBias;
 
   TemperatureBias = 0.0;
   TemperatureBias = targetSLtemp - GetTemperature(h);
+  if (TemperatureBias == OldBias) return;
+
   CalculatePressureBreakpoints();
 }
 
@@ -308,6 +360,8 @@ void FGStandardAtmosphere::SetTemperatureBias(eTemperature unit, double t)
   if (unit == eCelsius || unit == eKelvin)
     t *= 1.80; // If temp delta "t" is given in metric, scale up to English
 
+  if (t == TemperatureBias) return;
+
   TemperatureBias = t;
   CalculatePressureBreakpoints();
 }
@@ -343,7 +397,10 @@ void FGStandardAtmosphere::SetTemperatureGradedDelta(double deltemp, double h, e
   if (unit == eCelsius || unit == eKelvin)
     deltemp *= 1.80; // If temp delta "t" is given in metric, scale up to English
 
-  TemperatureDeltaGradient = deltemp/(GradientFadeoutAltitude - h);
+  double gradient = deltemp/(GradientFadeoutAltitude - h);
+  if (gradient == TemperatureDeltaGradient) return;
+
+  TemperatureDeltaGradient = gradient;
   CalculateLapseRates();
   CalculatePressureBreakpoints();
 }
@@ -407,6 +464,65 @@ void FGStandardAtmosphere::CalculatePressureBreakpoints()
       PressureBreakpointVector[b+1] = PressureBreakpointVector[b]*exp(-Mair*deltaH/(Rstar*Tmb));
     }
   }
+
+  // The profile is regenerated later by Run(), the layer equations are used
+  // meanwhile.
+  PressureProfileTop = 0.0;
+  PressureProfileStaleRuns = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The profile covers the geopotential altitudes from sea level to the top of
+// the temperature table. Each interval is the quintic Hermite polynomial that
+// matches the pressure and its first two derivatives at both ends of the
+// interval. The pressure is not smooth across a temperature breakpoint, so the
+// intervals that contain one are flagged and evaluated with the layer equations
+// instead.
+
+void FGStandardAtmosphere::CalculatePressureProfile()
+{
+  unsigned int numRows = StdAtmosTemperatureTable->GetNumRows();
+  double TopAlt = (*StdAtmosTemperatureTable)(numRows,0);
+  unsigned int n = (unsigned int)(TopAlt / ProfileSpacing);
+
+  PressureProfile.resize(n);
+  PressureProfileBreak.assign(n, 0);
+
+  double dPdh0, dPdh1, d2Pdh0, d2Pdh1;
+  double P0 = CalculatePressure(0.0, dPdh0, d2Pdh0);
+  const double h2 = ProfileSpacing*ProfileSpacing;
+
+  for (unsigned int i=0; i<n; i++) {
+    double P1 = CalculatePressure((i+1)*ProfileSpacing, dPdh1, d2Pdh1);
+    double dP = P1 - P0;
+    double m0 = dPdh0*ProfileSpacing, m1 = dPdh1*ProfileSpacing;
+    double a0 = d2Pdh0*h2, a1 = d2Pdh1*h2;
+    ProfileInterval& p = PressureProfile[i];
+    p.c0 = P0;
+    p.c1 = m0;
+    p.c2 = 0.5*a0;
+    p.c3 = 10.0*dP - 6.0*m0 - 4.0*m1 - 1.5*a0 + 0.5*a1;
+    p.c4 = -15.0*dP + 8.0*m0 + 7.0*m1 + 1.5*a0 - a1;
+    p.c5 = 6.0*dP - 3.0*m0 - 3.0*m1 - 0.5*a0 + 0.5*a1;
+    P0 = P1;
+    dPdh0 = dPdh1;
+    d2Pdh0 = d2Pdh1;
+  }
+
+  // Flag the intervals which upper bound lies on or above a breakpoint while
+  // their lower bound lies below it.
+  for (unsigned int r=2; r<numRows; r++) {
+    double BreakAlt = (*StdAtmosTemperatureTable)(r,0);
+    unsigned int i = (unsigned int)(BreakAlt / ProfileSpacing);
+    if (i*ProfileSpacing == BreakAlt) {
+      if (i > 0) PressureProfileBreak[i-1] = 1;
+    } else if (i < n) {
+      PressureProfileBreak[i] = 1;
+    }
+  }
+
+  PressureProfileTop = n*ProfileSpacing;
+  PressureProfileStaleRuns = 0;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
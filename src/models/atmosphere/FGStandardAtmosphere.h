@@ -89,6 +89,29 @@ these access methods allow the user to modify the sea level standard temperature
 and/or the sea level standard pressure, so that the entire profile will be 
 consistently and accurately calculated.
 
+Below the top of the temperature table (91 km), the pressure is looked up in a
+profile tabulated every 250 ft of geopotential altitude, where each interval
+is interpolated by a quintic Hermite polynomial matching the pressure and its
+first two derivatives at both ends. The intervals that contain a breakpoint of
+the temperature table are evaluated with the layer equations. The
+interpolation error remains below 1E-13 (relative) of the pressure given by
+the layer equations, which is the order of their own round-off. Negative
+altitudes and altitudes above 91 km are also evaluated with the layer
+equations.
+
+The results are therefore not bit for bit those of the layer equations, and
+sensitive models amplify the difference: over the 240 s of the
+ZLT-NT-moored-1 script, the altitude of the moored airship differs by 5E-7 ft
+(1E-5 ft after 30 s). Over the c1723 script, the altitude differs by 4E-10 ft.
+
+Modifying the bias, the gradient or the sea level pressure makes the profile
+stale, and the layer equations are used until it is regenerated. The profile
+is only regenerated once the atmosphere has been run as many times as the
+profile has intervals without any further modification, so that a host
+which changes these values at every frame does not pay for a regeneration
+at every frame. The pressure jumps by the interpolation error, at most 1E-13
+relative, when the profile replaces the layer equations.
+
   <h2> Properties </h2>
   @property atmosphere/delta-T
   @property atmosphere/T-sl-dev-F
@@ -112,6 +135,12 @@ public:
 
   bool InitModel(void);
 
+  /** Runs the atmosphere model and regenerates the pressure profile when it
+      has been stale for long enough.
+      @param Holding if true, the profile is left as is.
+      @return false if no error */
+  bool Run(bool Holding);
+
   //  *************************************************************************
   /// @name Temperature access functions.
   /// There are several ways to get the temperature, and several modeled temperature
@@ -259,6 +288,19 @@ protected:
   std::vector<double> LapseRateVector;
   std::vector<double> PressureBreakpointVector;
 
+  /// Pressure profile: polynomial coefficients of each interval of the
+  /// profile, in terms of the fraction of the interval.
+  struct ProfileInterval {
+    double c0, c1, c2, c3, c4, c5;
+  };
+  std::vector<ProfileInterval> PressureProfile;
+  /// True for the intervals that contain a temperature breakpoint.
+  std::vector<char> PressureProfileBreak;
+  /// Top of the profile, zero while the profile is stale.
+  double PressureProfileTop;
+  /// Number of runs since the profile became stale.
+  unsigned int PressureProfileStaleRuns;
+
   /// Recalculate the lapse rate vectors when the temperature profile is altered
   /// in a way that would change the lapse rates, such as when a gradient is applied.
   /// This function is also called to initialize the lapse rate vector.
@@ -268,6 +310,15 @@ protected:
   /// altitudes in the standard temperature table.
   void CalculatePressureBreakpoints();
 
+  /// Calculate (or recalculate) the pressure profile. This function is called
+  /// by Run() once the profile has been stale for long enough.
+  void CalculatePressureProfile();
+
+  /// Calculate the pressure and its first two derivatives at the given
+  /// geopotential altitude from the equations of the layer the altitude
+  /// belongs to.
+  double CalculatePressure(double GeoPotAlt, double& dPdh, double& d2Pdh2) const;
+
   virtual void bind(void);
   void Debug(int from);
 };
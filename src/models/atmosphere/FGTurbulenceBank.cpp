@@ -0,0 +1,159 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTurbulenceBank.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Precomputed Dryden turbulence sequences
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+
+#include "FGTurbulenceBank.h"
+#include "FGJSBBase.h"
+#include "math/FGRandom.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGTurbulenceBank.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_TURBULENCEBANK);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const unsigned int NumSamples = 1 << 18;
+static const unsigned int BlendSamples = 250; // 5 scale lengths
+
+const double FGTurbulenceBank::Spacing = 0.02;
+const double FGTurbulenceBank::Length = NumSamples * FGTurbulenceBank::Spacing;
+
+mutex FGTurbulenceBank::RegistryMutex;
+FGTurbulenceBank* FGTurbulenceBank::Instance = 0;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTurbulenceBank* FGTurbulenceBank::Acquire(void)
+{
+  lock_guard<mutex> lock(RegistryMutex);
+  if (!Instance) Instance = new FGTurbulenceBank();
+  Instance->refcount++;
+  return Instance;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbulenceBank::Release(FGTurbulenceBank* bank)
+{
+  if (!bank) return;
+
+  lock_guard<mutex> lock(RegistryMutex);
+  if (--bank->refcount == 0) {
+    Instance = 0;
+    delete bank;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The sequences are the outputs of the Dryden shaping filters driven by a unit
+// white noise, with the distance in scale lengths as the independent variable:
+//
+//   first order:  H(s) = 1/(1 + s),                state z1' = -z1 + n
+//   second order: H(s) = (1 + sqrt(3) s)/(1 + s)^2, states z1' = -z1 + n
+//                                                          z2' = -z2 + z1
+//                 y = sqrt(3) z1 + (1 - sqrt(3)) z2
+//
+// Over a step h the states are propagated with the transition matrix
+// exp(-h) [1 0; h 1] and receive a Gaussian increment whose covariance is
+// the integral of exp(-2t) [1 t; t t^2] over [0, h]. The initial states are
+// drawn from the stationary covariance [1/2 1/4; 1/4 1/4], for which the
+// variance of both outputs is 1.
+
+FGTurbulenceBank::FGTurbulenceBank(void) : refcount(0)
+{
+  const double h = Spacing;
+  const double a = exp(-h);
+  const double e2 = exp(-2.0*h);
+  const double q11 = 0.5*(1.0 - e2);
+  const double q12 = 0.25*(1.0 - e2*(1.0 + 2.0*h));
+  const double q22 = 0.25*(1.0 - e2*(1.0 + 2.0*h + 2.0*h*h));
+  // Cholesky factor of the covariance of the increments
+  const double l11 = sqrt(q11);
+  const double l21 = q12/l11;
+  const double l22 = sqrt(q22 - l21*l21);
+  const double sqrt3 = sqrt(3.0);
+
+  for (int filter=0; filter<eNumFilters; filter++) {
+    FGRandom random(1, filter);
+    vector<double> y(NumSamples + BlendSamples);
+    double n[2];
+
+    random.GetNormal(n, 2);
+    double z1 = sqrt(0.5)*n[0];
+    double z2 = 0.5*sqrt(0.5)*(n[0] + n[1]);
+
+    for (unsigned int k=0; k<y.size(); k++) {
+      if (filter == eFirstOrder)
+        y[k] = sqrt(2.0)*z1;
+      else
+        y[k] = sqrt3*z1 + (1.0 - sqrt3)*z2;
+
+      random.GetNormal(n, 2);
+      z2 = a*(h*z1 + z2) + l21*n[0] + l22*n[1];
+      z1 = a*z1 + l11*n[0];
+    }
+
+    // The samples past the end fade into the first samples with weights whose
+    // squares add up to 1, which preserves the variance.
+    for (unsigned int k=0; k<BlendSamples; k++) {
+      double theta = 0.5*M_PI*k/BlendSamples;
+      y[k] = sin(theta)*y[k] + cos(theta)*y[NumSamples + k];
+    }
+
+    Sequences[filter].assign(y.begin(), y.begin() + NumSamples);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTurbulenceBank::GetValue(eFilter filter, double s) const
+{
+  double u = s/Spacing;
+  u -= NumSamples*floor(u/NumSamples);
+
+  unsigned int i0 = (unsigned int)u;
+  if (i0 >= NumSamples) i0 = NumSamples - 1;
+  unsigned int i1 = (i0 + 1) % NumSamples;
+  double f = u - i0;
+
+  const vector<float>& y = Sequences[filter];
+  return (1.0 - f)*y[i0] + f*y[i1];
+}
+}
@@ -0,0 +1,127 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTurbulenceBank.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTURBULENCEBANK_H
+#define FGTURBULENCEBANK_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+#include <mutex>
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_TURBULENCEBANK "$Id: FGTurbulenceBank.h,v 1.0 2026/10/18 Outerra Exp $"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Precomputed sequences of Dryden turbulence shared by the FGWinds instances.
+
+    Under the frozen turbulence hypothesis, a Dryden velocity component is a
+    function of the distance flown through the air. Once this distance is
+    expressed in scale lengths and the velocity in standard deviations, the
+    Dryden spectra no longer depend on the airspeed, the altitude or the
+    severity. A single sequence per spectrum can then serve all the aircraft
+    and all the flight conditions: an aircraft reads it at its own distance
+    flown divided by the scale length and scales the result by the intensity.
+
+    Two sequences with a unit variance are generated, sampled every Spacing
+    scale lengths:
+    - eFirstOrder: spectrum 1/(1 + W^2), i.e. the longitudinal Dryden
+      spectrum (autocorrelation exp(-s)).
+    - eSecondOrder: spectrum (1 + 3 W^2)/(1 + W^2)^2, i.e. the lateral and
+      vertical Dryden spectrum (autocorrelation (1 - s/2) exp(-s)).
+
+    The shaping filters are discretized exactly (the noise covariance over a
+    step is integrated analytically) so the statistics of the sequences do
+    not depend on the spacing. The end of each sequence is blended into its
+    start so that it can be read periodically without a discontinuity. The
+    sequences are generated with a fixed seed the first time they are
+    acquired (which takes a few milliseconds) and are stored as floats. An
+    aircraft that reads them at a random offset gets a realization that is
+    independent of the other aircraft for Length scale lengths of flight.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTurbulenceBank
+{
+public:
+  /// Spectrum of a sequence.
+  enum eFilter {eFirstOrder=0, eSecondOrder, eNumFilters};
+
+  /// Distance between two samples (scale lengths).
+  static const double Spacing;
+  /// Period of the sequences (scale lengths).
+  static const double Length;
+
+  /** Returns the bank, generating it if needed. The bank must be released
+      with Release(). */
+  static FGTurbulenceBank* Acquire(void);
+  /// Releases the bank. The bank is deleted when no FGWinds uses it.
+  static void Release(FGTurbulenceBank* bank);
+
+  /** Reads a sequence.
+      @param filter spectrum of the sequence
+      @param s distance (scale lengths), read modulo Length
+      @return the value, interpolated linearly between the samples */
+  double GetValue(eFilter filter, double s) const;
+
+private:
+  FGTurbulenceBank(void);
+
+  unsigned int refcount;
+  std::vector<float> Sequences[eNumFilters];
+
+  static std::mutex RegistryMutex;
+  static FGTurbulenceBank* Instance;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,416 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGWindField.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Gridded wind field read from a memory mapped file
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+#include "FGWindField.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGWindField.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_WINDFIELD);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const char Magic[8] = {'J', 'S', 'B', 'S', 'I', 'M', 'W', 'F'};
+static const size_t HeaderSize = 112;
+static const double EarthRadius = 20925646.32546; // ft
+static const size_t PrefetchBudget = 256 << 20; // bytes
+
+mutex FGWindField::RegistryMutex;
+map<string, FGWindField*> FGWindField::Registry;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGWindField* FGWindField::Open(const SGPath& file)
+{
+  lock_guard<mutex> lock(RegistryMutex);
+
+  map<string, FGWindField*>::iterator it = Registry.find(file.utf8Str());
+  if (it != Registry.end()) {
+    it->second->refcount++;
+    return it->second;
+  }
+
+  FGWindField* field = new FGWindField(file);
+  if (!field->Data) {
+    delete field;
+    return 0;
+  }
+
+  field->refcount = 1;
+  Registry[file.utf8Str()] = field;
+  return field;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWindField::Close(FGWindField* field)
+{
+  if (!field) return;
+
+  lock_guard<mutex> lock(RegistryMutex);
+  if (--field->refcount == 0) {
+    Registry.erase(field->FileName.utf8Str());
+    delete field;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGWindField::FGWindField(const SGPath& file)
+  : FileName(file), refcount(0), Data(0), Size(0), Wrap(false), TileSize(0),
+    MaxLoaded(0), Stopping(false)
+{
+#if defined(_WIN32)
+  FileHandle = MappingHandle = 0;
+#else
+  FileDescriptor = -1;
+#endif
+
+  if (Map())
+    Prefetcher = thread(&FGWindField::PrefetchLoop, this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGWindField::~FGWindField()
+{
+  if (Prefetcher.joinable()) {
+    {
+      lock_guard<mutex> lock(Mutex);
+      Stopping = true;
+    }
+    QueueNotEmpty.notify_all();
+    Prefetcher.join();
+  }
+
+  Unmap();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGWindField::Map(void)
+{
+#if defined(_WIN32)
+  HANDLE file = CreateFileA(FileName.utf8Str().c_str(), GENERIC_READ,
+                            FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, NULL);
+  LARGE_INTEGER size;
+  if (file == INVALID_HANDLE_VALUE) {
+    cerr << "Could not open the wind field file " << FileName.utf8Str() << endl;
+    return false;
+  }
+  FileHandle = file;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)HeaderSize) {
+    cerr << "Invalid wind field file " << FileName.utf8Str() << endl;
+    Unmap();
+    return false;
+  }
+  MappingHandle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (MappingHandle)
+    Data = (const char*)MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0);
+  Size = (size_t)size.QuadPart;
+#else
+  FileDescriptor = open(FileName.utf8Str().c_str(), O_RDONLY);
+  struct stat st;
+  if (FileDescriptor < 0) {
+    cerr << "Could not open the wind field file " << FileName.utf8Str() << endl;
+    return false;
+  }
+  if (fstat(FileDescriptor, &st) != 0 || st.st_size < (off_t)HeaderSize) {
+    cerr << "Invalid wind field file " << FileName.utf8Str() << endl;
+    Unmap();
+    return false;
+  }
+  Size = (size_t)st.st_size;
+  void* data = mmap(0, Size, PROT_READ, MAP_SHARED, FileDescriptor, 0);
+  if (data != MAP_FAILED) Data = (const char*)data;
+#endif
+
+  if (!Data) {
+    cerr << "Could not map the wind field file " << FileName.utf8Str() << endl;
+    Unmap();
+    return false;
+  }
+
+  unsigned int version;
+  memcpy(&version, Data + 8, sizeof(unsigned int));
+  memcpy(Nodes, Data + 12, sizeof(Nodes));
+  memcpy(TileNodes, Data + 28, sizeof(TileNodes));
+  memcpy(Origin, Data + 48, sizeof(Origin));
+  memcpy(Step, Data + 80, sizeof(Step));
+
+  bool valid = memcmp(Data, Magic, sizeof(Magic)) == 0 && version == 1;
+  size_t nTiles = 1;
+  size_t nTileNodes = 1;
+  for (int i=0; valid && i<4; i++) {
+    valid = Nodes[i] > 0 && TileNodes[i] > 0 && (Nodes[i] == 1 || Step[i] > 0.0);
+    Tiles[i] = (Nodes[i] + TileNodes[i] - 1) / TileNodes[i];
+    nTiles *= Tiles[i];
+    nTileNodes *= TileNodes[i];
+  }
+  TileSize = nTileNodes * 3 * sizeof(float);
+
+  if (!valid || HeaderSize + nTiles * TileSize > Size) {
+    cerr << "Invalid wind field file " << FileName.utf8Str() << endl;
+    Unmap();
+    return false;
+  }
+
+  Wrap = Nodes[1] > 1 && Nodes[1]*Step[1] >= 360.0 - 1E-9;
+  Requested.assign(nTiles, 0);
+  MaxLoaded = PrefetchBudget / TileSize;
+  if (MaxLoaded < 16) MaxLoaded = 16;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWindField::Unmap(void)
+{
+#if defined(_WIN32)
+  if (Data) UnmapViewOfFile(Data);
+  if (MappingHandle) CloseHandle((HANDLE)MappingHandle);
+  if (FileHandle) CloseHandle((HANDLE)FileHandle);
+  FileHandle = MappingHandle = 0;
+#else
+  if (Data) munmap((void*)Data, Size);
+  if (FileDescriptor >= 0) close(FileDescriptor);
+  FileDescriptor = -1;
+#endif
+  Data = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The latitude and the longitude are in degrees, the altitude in feet and the
+// time in seconds.
+
+bool FGWindField::Locate(int axis, double x, unsigned int& i0,
+                         unsigned int& i1, double& f) const
+{
+  unsigned int n = Nodes[axis];
+
+  if (n == 1) {
+    i0 = i1 = 0;
+    f = 0.0;
+    return true;
+  }
+
+  double u = (x - Origin[axis]) / Step[axis];
+
+  if (axis == 1 && Wrap) {
+    u -= n*floor(u/n);
+    i0 = (unsigned int)u;
+    if (i0 >= n) i0 = n-1;
+    f = u - i0;
+    i1 = (i0 + 1) % n;
+    return true;
+  }
+
+  if (u < 0.0 || u > n-1) {
+    if (axis < 2) return false;
+    u = u < 0.0 ? 0.0 : n-1;
+  }
+
+  i0 = (unsigned int)u;
+  if (i0 >= n-1) i0 = n-2;
+  f = u - i0;
+  i1 = i0 + 1;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int FGWindField::GetTile(const unsigned int idx[4]) const
+{
+  unsigned int tile = 0;
+  for (int i=3; i>=0; i--)
+    tile = tile*Tiles[i] + idx[i]/TileNodes[i];
+  return tile;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const float* FGWindField::GetNode(const unsigned int idx[4]) const
+{
+  size_t node = 0;
+  for (int i=3; i>=0; i--)
+    node = node*TileNodes[i] + idx[i]%TileNodes[i];
+
+  const char* tile = Data + HeaderSize + GetTile(idx)*TileSize;
+  return (const float*)tile + 3*node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGWindField::GetWind(double lat, double lon, double alt, double t,
+                          FGColumnVector3& wind) const
+{
+  double x[4] = {lat*radtodeg, lon*radtodeg, alt, t};
+  unsigned int i0[4], i1[4];
+  double f[4];
+
+  for (int i=0; i<4; i++)
+    if (!Locate(i, x[i], i0[i], i1[i], f[i])) return false;
+
+  double w[3] = {0.0, 0.0, 0.0};
+
+  for (unsigned int corner=0; corner<16; corner++) {
+    unsigned int idx[4];
+    double weight = 1.0;
+    for (int i=0; i<4; i++) {
+      if (corner & (1 << i)) {
+        idx[i] = i1[i];
+        weight *= f[i];
+      } else {
+        idx[i] = i0[i];
+        weight *= 1.0 - f[i];
+      }
+    }
+    if (weight == 0.0) continue;
+
+    const float* node = GetNode(idx);
+    for (int k=0; k<3; k++) w[k] += weight*node[k];
+  }
+
+  wind(eNorth) = w[0];
+  wind(eEast) = w[1];
+  wind(eDown) = w[2];
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The path is sampled at a few points and the tiles containing the nodes that
+// surround each point are queued.
+
+void FGWindField::Prefetch(double lat, double lon, double alt, double t,
+                           const FGColumnVector3& vel, double horizon)
+{
+  const int nSteps = 8;
+  double coslat = cos(lat);
+  if (coslat < 0.01) coslat = 0.01;
+
+  vector<unsigned int> tiles;
+
+  for (int k=0; k<=nSteps; k++) {
+    double dt = horizon*k/nSteps;
+    double x[4] = {(lat + vel(eNorth)*dt/EarthRadius)*radtodeg,
+                   (lon + vel(eEast)*dt/(EarthRadius*coslat))*radtodeg,
+                   alt - vel(eDown)*dt,
+                   t + dt};
+    unsigned int i0[4], i1[4];
+    double f;
+    bool inside = true;
+
+    for (int i=0; inside && i<4; i++)
+      inside = Locate(i, x[i], i0[i], i1[i], f);
+    if (!inside) continue;
+
+    for (unsigned int corner=0; corner<16; corner++) {
+      unsigned int idx[4];
+      for (int i=0; i<4; i++)
+        idx[i] = (corner & (1 << i)) ? i1[i] : i0[i];
+      tiles.push_back(GetTile(idx));
+    }
+  }
+
+  bool queued = false;
+  {
+    lock_guard<mutex> lock(Mutex);
+    for (unsigned int i=0; i<tiles.size(); i++) {
+      if (!Requested[tiles[i]]) {
+        Requested[tiles[i]] = 1;
+        Queue.push_back(tiles[i]);
+        queued = true;
+      }
+    }
+  }
+  if (queued) QueueNotEmpty.notify_one();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Reading one byte in each page of a tile makes the system load the tile in
+// memory, so that the simulation thread does not wait for the disk when it
+// reaches the tile. Once more than MaxLoaded tiles have been loaded after a
+// tile, the system may have evicted it, so it is no longer flagged as
+// requested.
+
+void FGWindField::PrefetchLoop(void)
+{
+  volatile char sink = 0;
+
+  for (;;) {
+    unsigned int tile;
+    {
+      unique_lock<mutex> lock(Mutex);
+      while (Queue.empty() && !Stopping) QueueNotEmpty.wait(lock);
+      if (Stopping) return;
+      tile = Queue.front();
+      Queue.pop_front();
+    }
+
+    const char* data = Data + HeaderSize + tile*TileSize;
+    for (size_t offset=0; offset<TileSize; offset+=4096)
+      sink = sink + data[offset];
+    sink = sink + data[TileSize-1];
+
+    lock_guard<mutex> lock(Mutex);
+    Loaded.push_back(tile);
+    if (Loaded.size() > MaxLoaded) {
+      Requested[Loaded.front()] = 0;
+      Loaded.pop_front();
+    }
+  }
+}
+}
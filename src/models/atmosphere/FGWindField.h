@@ -0,0 +1,191 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGWindField.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGWINDFIELD_H
+#define FGWINDFIELD_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "FGJSBBase.h"
+#include "math/FGColumnVector3.h"
+#include "simgear/misc/sg_path.hxx"
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_WINDFIELD "$Id: FGWindField.h,v 1.0 2026/10/18 Outerra Exp $"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** A wind field gridded in latitude, longitude, altitude and time, read from
+    a memory mapped binary file.
+
+    The grid is split in tiles of equal size that are stored contiguously in
+    the file, so that the part of the file needed around the aircraft is small
+    and can be read ahead of the aircraft by a background thread (see
+    Prefetch()). The wind is interpolated linearly along each of the 4 axes.
+    The file is shared by all the FGWinds instances of the process that use it:
+    Open() returns the same instance for the same file.
+
+    The file is made of a header followed by the tiles. All the values are in
+    the native byte order of the machine:
+
+    - header (112 bytes): the 8 characters "JSBSIMWF", the uint32 values
+      version (1), the number of nodes along the latitude, longitude, altitude
+      and time axes, the number of nodes of a tile along the same axes and a
+      padding value (0), then the doubles origin of the latitude (deg),
+      longitude (deg), altitude (ft above sea level) and time (s) axes followed
+      by the spacing of the nodes along the same axes.
+    - tiles: each tile holds the nodes of the tile as 3 floats (the north,
+      east and down wind components in ft/s). In a tile as well as in the
+      grid of tiles, the latitude varies fastest, then the longitude, the
+      altitude and the time. The tiles at the end of an axis are padded to
+      the full size of a tile.
+
+    If the longitude axis spans 360 degrees, the field is wrapped around the
+    globe. Otherwise the field is only defined over the area covered by the
+    grid. The altitude and the time are clamped to the range of the grid.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGWindField : public FGJSBBase
+{
+public:
+  /** Opens a wind field file, or returns the instance that has already opened
+      it. The instance must be released with Close().
+      @param file name of the file
+      @return the wind field, or 0 if the file could not be opened */
+  static FGWindField* Open(const SGPath& file);
+  /// Releases a wind field. The file is closed when no FGWinds uses it.
+  static void Close(FGWindField* field);
+
+  /** Interpolates the wind.
+      @param lat geodetic latitude (rad)
+      @param lon longitude (rad)
+      @param alt altitude above sea level (ft)
+      @param t time (s)
+      @param wind receives the north, east and down components (ft/s)
+      @return false if the location is outside the field */
+  bool GetWind(double lat, double lon, double alt, double t,
+               FGColumnVector3& wind) const;
+
+  /** Requests the background loading of the tiles along a straight line path.
+      A tile is only loaded once as long as it is one of the last tiles
+      loaded, up to PrefetchBudget bytes: older tiles may have been evicted
+      from memory by the system and are loaded again when requested.
+      @param lat geodetic latitude (rad)
+      @param lon longitude (rad)
+      @param alt altitude above sea level (ft)
+      @param t time (s)
+      @param vel velocity in the local frame (ft/s)
+      @param horizon duration of the path (s) */
+  void Prefetch(double lat, double lon, double alt, double t,
+                const FGColumnVector3& vel, double horizon);
+
+  const SGPath& GetFileName(void) const { return FileName; }
+
+private:
+  FGWindField(const SGPath& file);
+  ~FGWindField();
+
+  bool Map(void);
+  void Unmap(void);
+
+  /** Locates a coordinate on an axis.
+      @return false if the coordinate is outside of an axis that is not
+              clamped */
+  bool Locate(int axis, double x, unsigned int& i0, unsigned int& i1,
+              double& f) const;
+  const float* GetNode(const unsigned int idx[4]) const;
+  unsigned int GetTile(const unsigned int idx[4]) const;
+  void PrefetchLoop(void);
+
+  SGPath FileName;
+  unsigned int refcount;
+
+  const char* Data;
+  size_t Size;
+#if defined(_WIN32)
+  void* FileHandle;
+  void* MappingHandle;
+#else
+  int FileDescriptor;
+#endif
+
+  unsigned int Nodes[4];      // nodes along each axis
+  unsigned int TileNodes[4];  // nodes of a tile along each axis
+  unsigned int Tiles[4];      // tiles along each axis
+  double Origin[4];
+  double Step[4];
+  bool Wrap;                  // the longitude spans the globe
+  size_t TileSize;            // bytes
+
+  std::vector<char> Requested;
+  std::deque<unsigned int> Queue;
+  std::deque<unsigned int> Loaded;  // last tiles loaded, oldest first
+  size_t MaxLoaded;
+  std::mutex Mutex;
+  std::condition_variable QueueNotEmpty;
+  std::thread Prefetcher;
+  bool Stopping;
+
+  static std::mutex RegistryMutex;
+  static std::map<std::string, FGWindField*> Registry;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -45,6 +45,8 @@ INCLUDES
 #include <iostream>
 #include <cstdlib>
 #include "FGWinds.h"
+#include "FGWindField.h"
+#include "FGTurbulenceBank.h"
 #include "FGFDMExec.h"
 
 using namespace std;
@@ -84,6 +86,9 @@ FGWinds::FGWinds(FGFDMExec* fdmex) : FGModel(fdmex)
   TurbRate = 10.0;
   Rhythmicity = 0.1;
   spike = target_time = strength = 0.0;
+  TurbBank = 0;
+  TurbPrecomputed = 0;
+  ResetTurbulenceHistory();
   wind_from_clockwise = 0.0;
   psiw = 0.0;
 
@@ -91,6 +96,12 @@ FGWinds::FGWinds(FGFDMExec* fdmex) : FGModel(fdmex)
   vTurbulenceNED.InitMatrix();
   vCosineGust.InitMatrix();
 
+  WindField = 0;
+  WindFieldTimeOffset = 0.0;
+  WindFieldHorizon = 60.0;
+  WindFieldPrefetchTime = -HUGE_VAL;
+  WindFieldGradients = 0;
+
   // Milspec turbulence model
   windspeed_at_20ft = 0.;
   probability_of_exceedence_index = 0;
@@ -116,6 +127,8 @@ FGWinds::FGWinds(FGFDMExec* fdmex) : FGModel(fdmex)
 FGWinds::~FGWinds()
 {
   delete(POE_Table);
+  FGWindField::Close(WindField);
+  FGTurbulenceBank::Release(TurbBank);
   Debug(1);
 }
 
@@ -126,10 +139,14 @@ bool FGWinds::InitModel(void)
   if (!FGModel::InitModel()) return false;
 
   psiw = 0.0;
+  ResetTurbulenceHistory();
 
   vGustNED.InitMatrix();
   vTurbulenceNED.InitMatrix();
   vCosineGust.InitMatrix();
+  vWindFieldNED.InitMatrix();
+  vWindFieldPQR.InitMatrix();
+  WindFieldPrefetchTime = -HUGE_VAL;
 
   oneMinusCosineGust.gustProfile.Running = false;
   oneMinusCosineGust.gustProfile.elapsedTime = 0.0;
@@ -139,6 +156,19 @@ bool FGWinds::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGWinds::ResetTurbulenceHistory(void)
+{
+  xi_u_km1 = nu_u_km1 = 0.0;
+  xi_v_km1 = xi_v_km2 = nu_v_km1 = nu_v_km2 = 0.0;
+  xi_w_km1 = xi_w_km2 = nu_w_km1 = nu_w_km2 = 0.0;
+  xi_p_km1 = nu_p_km1 = 0.0;
+  xi_q_km1 = xi_r_km1 = 0.0;
+  TurbPhaseDrawn = false;
+  TurbScales.h = -HUGE_VAL;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGWinds::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
@@ -146,8 +176,9 @@ bool FGWinds::Run(bool Holding)
 
   if (turbType != ttNone) Turbulence(in.AltitudeASL);
   if (oneMinusCosineGust.gustProfile.Running) CosineGust();
+  if (WindField) SampleWindField();
 
-  vTotalWindNED = vWindNED + vGustNED + vCosineGust + vTurbulenceNED;
+  vTotalWindNED = vWindNED + vGustNED + vCosineGust + vTurbulenceNED + vWindFieldNED;
 
    // psiw (Wind heading) is the direction the wind is blowing towards
   if (vWindNED(eX) != 0.0) psiw = atan2( vWindNED(eY), vWindNED(eX) );
@@ -193,6 +224,147 @@ void FGWinds::SetWindPsi(double dir)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGWinds::LoadWindField(const SGPath& file)
+{
+  FGWindField* field = FGWindField::Open(file);
+  if (!field) return false;
+
+  UnloadWindField();
+  WindField = field;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::UnloadWindField(void)
+{
+  FGWindField::Close(WindField);
+  WindField = 0;
+  vWindFieldNED.InitMatrix();
+  vWindFieldPQR.InitMatrix();
+  WindFieldPrefetchTime = -HUGE_VAL;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Opening the file again returns the instance already registered for it.
+
+void FGWinds::ShareWindField(const FGWinds* source)
+{
+  if (source->WindField != WindField) {
+    if (source->WindField)
+      LoadWindField(source->WindField->GetFileName());
+    else
+      UnloadWindField();
+  }
+
+  WindFieldTimeOffset = source->WindFieldTimeOffset;
+  WindFieldHorizon = source->WindFieldHorizon;
+  WindFieldGradients = source->WindFieldGradients;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Samples the wind field at an offset (ft) from the aircraft location in the
+// body frame. The wind is returned in the body frame.
+
+bool FGWinds::SampleWindField(double x, double y, double z, double t,
+                              FGColumnVector3& wind) const
+{
+  FGColumnVector3 offset = in.Tl2b.Transposed() * FGColumnVector3(x, y, z);
+  double radius = in.planetRadius + in.AltitudeASL;
+  double lat = in.latitude + offset(eNorth)/radius;
+  double lon = in.longitude + offset(eEast)/(radius*cos(in.latitude));
+
+  if (!WindField->GetWind(lat, lon, in.AltitudeASL - offset(eDown), t, wind))
+    return false;
+
+  wind = in.Tl2b * wind;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The rotation of the air is estimated from the differences of the wind
+// between the wing tips (roll) and between the CG and the horizontal tail
+// (pitch and yaw), as in Etkin's treatment of gust gradients:
+// p = dw/dy, q = -dw/dx and r = dv/dx.
+
+void FGWinds::SampleWindField(void)
+{
+  double t = FDMExec->GetSimTime() + WindFieldTimeOffset;
+
+  vWindFieldPQR.InitMatrix();
+
+  if (!WindField->GetWind(in.latitude, in.longitude, in.AltitudeASL, t,
+                          vWindFieldNED)) {
+    vWindFieldNED.InitMatrix();
+  } else if (WindFieldGradients) {
+    FGColumnVector3 wCG = in.Tl2b * vWindFieldNED, wLeft, wRight, wTail;
+    double b = in.wingspan, lt = in.HTailArm;
+
+    if (b > 0.0 && SampleWindField(0.0, 0.5*b, 0.0, t, wRight)
+                && SampleWindField(0.0, -0.5*b, 0.0, t, wLeft))
+      vWindFieldPQR(eP) = (wRight(eW) - wLeft(eW))/b;
+
+    if (lt > 0.0 && SampleWindField(-lt, 0.0, 0.0, t, wTail)) {
+      vWindFieldPQR(eQ) = -(wCG(eW) - wTail(eW))/lt;
+      vWindFieldPQR(eR) = (wCG(eV) - wTail(eV))/lt;
+    }
+  }
+
+  // The prefetch requests are renewed every second of simulation time.
+  if (fabs(t - WindFieldPrefetchTime) >= 1.0) {
+    WindField->Prefetch(in.latitude, in.longitude, in.AltitudeASL, t, in.vVel,
+                        WindFieldHorizon);
+    WindFieldPrefetchTime = t;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::UpdateDrydenScales(double h, double b_w)
+{
+  double L_u, L_w, sig_u, sig_w;
+
+  // Scale lengths L and amplitudes sigma as function of height
+  if (h <= 1000) {
+    L_u = h/pow(0.177 + 0.000823*h, 1.2); // MIL-F-8785c, Fig. 10, p. 55
+    L_w = h;
+    sig_w = 0.1*windspeed_at_20ft;
+    sig_u = sig_w/pow(0.177 + 0.000823*h, 0.4); // MIL-F-8785c, Fig. 11, p. 56
+  } else if (h <= 2000) {
+    // linear interpolation between low altitude and high altitude models
+    L_u = L_w = 1000 + (h-1000.)/1000.*750.;
+    sig_u = sig_w = 0.1*windspeed_at_20ft
+                  + (h-1000.)/1000.*(POE_Table->GetValue(probability_of_exceedence_index, h) - 0.1*windspeed_at_20ft);
+  } else {
+    L_u = L_w = 1750.; //  MIL-F-8785c, Sec. 3.7.2.1, p. 48
+    sig_u = sig_w = POE_Table->GetValue(probability_of_exceedence_index, h);
+  }
+
+  TurbScales.h = h;
+  TurbScales.b_w = b_w;
+  TurbScales.windspeed_at_20ft = windspeed_at_20ft;
+  TurbScales.severity = probability_of_exceedence_index;
+  TurbScales.L_u = L_u;
+  TurbScales.L_w = L_w;
+  TurbScales.L_p = sqrt(L_w*b_w)/2.6; // Yeager1998, eq. (10)
+  TurbScales.sig_u = sig_u;
+  TurbScales.sig_w = sig_w;
+  TurbScales.sig_p = 1.9/sqrt(L_w*b_w)*sig_w; // eq. (8)
+  //sig_q = sqrt(M_PI/2/L_w/b_w), // eq. (14)
+  //sig_r = sqrt(2*M_PI/3/L_w/b_w), // eq. (17)
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::AdvanceTurbulencePhase(int idx, double ds)
+{
+  TurbPhase[idx] += ds;
+  if (TurbPhase[idx] >= FGTurbulenceBank::Length)
+    TurbPhase[idx] -= FGTurbulenceBank::Length;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGWinds::Turbulence(double h)
 {
   switch (turbType) {
@@ -216,7 +388,7 @@ void FGWinds::Turbulence(double h)
 
     double random = 0.0;
     if (target_time == 0.0) {
-      strength = random = 1 - 2.0*(double(rand())/double(RAND_MAX));
+      strength = random = -FDMExec->GetRandom().GetUniformSigned();
       target_time = time + 0.71 + (random * 0.5);
     }
     if (time > target_time) {
@@ -258,65 +430,81 @@ void FGWinds::Turbulence(double h)
     }
 
     // Turbulence model according to MIL-F-8785C (Flying Qualities of Piloted Aircraft)
-    double b_w = in.wingspan, L_u, L_w, sig_u, sig_w;
+    double b_w = in.wingspan;
 
       if (b_w == 0.) b_w = 30.;
 
     // clip height functions at 10 ft
     if (h <= 10.) h = 10;
 
-    // Scale lengths L and amplitudes sigma as function of height
-    if (h <= 1000) {
-      L_u = h/pow(0.177 + 0.000823*h, 1.2); // MIL-F-8785c, Fig. 10, p. 55
-      L_w = h;
-      sig_w = 0.1*windspeed_at_20ft;
-      sig_u = sig_w/pow(0.177 + 0.000823*h, 0.4); // MIL-F-8785c, Fig. 11, p. 56
-    } else if (h <= 2000) {
-      // linear interpolation between low altitude and high altitude models
-      L_u = L_w = 1000 + (h-1000.)/1000.*750.;
-      sig_u = sig_w = 0.1*windspeed_at_20ft
-                    + (h-1000.)/1000.*(POE_Table->GetValue(probability_of_exceedence_index, h) - 0.1*windspeed_at_20ft);
-    } else {
-      L_u = L_w = 1750.; //  MIL-F-8785c, Sec. 3.7.2.1, p. 48
-      sig_u = sig_w = POE_Table->GetValue(probability_of_exceedence_index, h);
-    }
-
-    // keep values from last timesteps
-    // TODO maybe use deque?
-    static double
-      xi_u_km1 = 0, nu_u_km1 = 0,
-      xi_v_km1 = 0, xi_v_km2 = 0, nu_v_km1 = 0, nu_v_km2 = 0,
-      xi_w_km1 = 0, xi_w_km2 = 0, nu_w_km1 = 0, nu_w_km2 = 0,
-      xi_p_km1 = 0, nu_p_km1 = 0,
-      xi_q_km1 = 0, xi_r_km1 = 0;
-
+    // With the precomputed sequences, the scales are only updated when the
+    // altitude has changed by more than 10 ft.
+    if (!TurbPrecomputed || fabs(h - TurbScales.h) > 10.0
+        || b_w != TurbScales.b_w
+        || windspeed_at_20ft != TurbScales.windspeed_at_20ft
+        || probability_of_exceedence_index != TurbScales.severity)
+      UpdateDrydenScales(h, b_w);
 
     double
+      L_u = TurbScales.L_u,
+      L_w = TurbScales.L_w,
+      L_p = TurbScales.L_p,
+      sig_u = TurbScales.sig_u,
+      sig_w = TurbScales.sig_w,
+      sig_p = TurbScales.sig_p,
       T_V = in.totalDeltaT, // for compatibility of nomenclature
-      sig_p = 1.9/sqrt(L_w*b_w)*sig_w, // Yeager1998, eq. (8)
-      //sig_q = sqrt(M_PI/2/L_w/b_w), // eq. (14)
-      //sig_r = sqrt(2*M_PI/3/L_w/b_w), // eq. (17)
-      L_p = sqrt(L_w*b_w)/2.6, // eq. (10)
       tau_u = L_u/in.V, // eq. (6)
       tau_w = L_w/in.V, // eq. (3)
       tau_p = L_p/in.V, // eq. (9)
       tau_q = 4*b_w/M_PI/in.V, // eq. (13)
       tau_r =3*b_w/M_PI/in.V, // eq. (17)
-      nu_u = GaussianRandomNumber(),
-      nu_v = GaussianRandomNumber(),
-      nu_w = GaussianRandomNumber(),
-      nu_p = GaussianRandomNumber(),
+      nu_u = 0, nu_v = 0, nu_w = 0, nu_p = 0,
       xi_u=0, xi_v=0, xi_w=0, xi_p=0, xi_q=0, xi_r=0;
 
+    if (TurbPrecomputed) {
+      // the velocities are read from the shared Dryden sequences at the
+      // distance flown through the air, expressed in scale lengths
+      if (!TurbBank) TurbBank = FGTurbulenceBank::Acquire();
+      if (!TurbPhaseDrawn) {
+        for (int i=0; i<4; i++)
+          TurbPhase[i] = FDMExec->GetRandom().GetUniform()*FGTurbulenceBank::Length;
+        TurbPhaseDrawn = true;
+      }
+
+      double ds = in.V*T_V;
+      AdvanceTurbulencePhase(0, ds/L_u);
+      AdvanceTurbulencePhase(3, ds/L_p);
+      xi_u = sig_u*TurbBank->GetValue(FGTurbulenceBank::eFirstOrder, TurbPhase[0]);
+      xi_p = sig_p*TurbBank->GetValue(FGTurbulenceBank::eFirstOrder, TurbPhase[3]);
+
+      if (turbType == ttTustin) {
+        // Dryden spectra of MIL-F-8785C
+        AdvanceTurbulencePhase(1, ds/L_u);
+        AdvanceTurbulencePhase(2, ds/L_w);
+        xi_v = sig_u*TurbBank->GetValue(FGTurbulenceBank::eSecondOrder, TurbPhase[1]);
+        xi_w = sig_w*TurbBank->GetValue(FGTurbulenceBank::eSecondOrder, TurbPhase[2]);
+      } else {
+        // first order approximations of MIL-STD-1797A, eqs. (31) and (32)
+        AdvanceTurbulencePhase(1, 2*ds/L_u);
+        AdvanceTurbulencePhase(2, 2*ds/L_w);
+        xi_v = sig_u*TurbBank->GetValue(FGTurbulenceBank::eFirstOrder, TurbPhase[1]);
+        xi_w = sig_w*TurbBank->GetValue(FGTurbulenceBank::eFirstOrder, TurbPhase[2]);
+      }
+    } else {
+      // white noise inputs, drawn from the generator of this FDM
+      double nu[4];
+      FDMExec->GetRandom().GetNormal(nu, 4);
+      nu_u = nu[0];
+      nu_v = nu[1];
+      nu_w = nu[2];
+      nu_p = nu[3];
+    }
+
     // values of turbulence NED velocities
 
     if (turbType == ttTustin) {
       // the following is the Tustin formulation of Yeager's report
       double
-        omega_w = in.V/L_w, // hidden in nomenclature p. 3
-        omega_v = in.V/L_u, // this is defined nowhere
-        C_BL  = 1/tau_u/tan(T_V/2/tau_u), // eq. (19)
-        C_BLp = 1/tau_p/tan(T_V/2/tau_p), // eq. (22)
         C_BLq = 1/tau_q/tan(T_V/2/tau_q), // eq. (24)
         C_BLr = 1/tau_r/tan(T_V/2/tau_r); // eq. (26)
 
@@ -324,22 +512,30 @@ void FGWinds::Turbulence(double h)
       // the random numbers nu_*. This means that in the code below, all
       // divisors are strictly positive, too, and no floating point
       // exception should occur.
-      xi_u = -(1 - C_BL*tau_u)/(1 + C_BL*tau_u)*xi_u_km1
-           + sig_u*sqrt(2*tau_u/T_V)/(1 + C_BL*tau_u)*(nu_u + nu_u_km1); // eq. (18)
-      xi_v = -2*(sqr(omega_v) - sqr(C_BL))/sqr(omega_v + C_BL)*xi_v_km1
-           - sqr(omega_v - C_BL)/sqr(omega_v + C_BL) * xi_v_km2
-           + sig_u*sqrt(3*omega_v/T_V)/sqr(omega_v + C_BL)*(
-                 (C_BL + omega_v/sqrt(3.))*nu_v
-               + 2/sqrt(3.)*omega_v*nu_v_km1
-               + (omega_v/sqrt(3.) - C_BL)*nu_v_km2); // eq. (20) for v
-      xi_w = -2*(sqr(omega_w) - sqr(C_BL))/sqr(omega_w + C_BL)*xi_w_km1
-           - sqr(omega_w - C_BL)/sqr(omega_w + C_BL) * xi_w_km2
-           + sig_w*sqrt(3*omega_w/T_V)/sqr(omega_w + C_BL)*(
-                 (C_BL + omega_w/sqrt(3.))*nu_w
-               + 2/sqrt(3.)*omega_w*nu_w_km1
-               + (omega_w/sqrt(3.) - C_BL)*nu_w_km2); // eq. (20) for w
-      xi_p = -(1 - C_BLp*tau_p)/(1 + C_BLp*tau_p)*xi_p_km1
-           + sig_p*sqrt(2*tau_p/T_V)/(1 + C_BLp*tau_p) * (nu_p + nu_p_km1); // eq. (21)
+      if (!TurbPrecomputed) {
+        double
+          omega_w = in.V/L_w, // hidden in nomenclature p. 3
+          omega_v = in.V/L_u, // this is defined nowhere
+          C_BL  = 1/tau_u/tan(T_V/2/tau_u), // eq. (19)
+          C_BLp = 1/tau_p/tan(T_V/2/tau_p); // eq. (22)
+
+        xi_u = -(1 - C_BL*tau_u)/(1 + C_BL*tau_u)*xi_u_km1
+             + sig_u*sqrt(2*tau_u/T_V)/(1 + C_BL*tau_u)*(nu_u + nu_u_km1); // eq. (18)
+        xi_v = -2*(sqr(omega_v) - sqr(C_BL))/sqr(omega_v + C_BL)*xi_v_km1
+             - sqr(omega_v - C_BL)/sqr(omega_v + C_BL) * xi_v_km2
+             + sig_u*sqrt(3*omega_v/T_V)/sqr(omega_v + C_BL)*(
+                   (C_BL + omega_v/sqrt(3.))*nu_v
+                 + 2/sqrt(3.)*omega_v*nu_v_km1
+                 + (omega_v/sqrt(3.) - C_BL)*nu_v_km2); // eq. (20) for v
+        xi_w = -2*(sqr(omega_w) - sqr(C_BL))/sqr(omega_w + C_BL)*xi_w_km1
+             - sqr(omega_w - C_BL)/sqr(omega_w + C_BL) * xi_w_km2
+             + sig_w*sqrt(3*omega_w/T_V)/sqr(omega_w + C_BL)*(
+                   (C_BL + omega_w/sqrt(3.))*nu_w
+                 + 2/sqrt(3.)*omega_w*nu_w_km1
+                 + (omega_w/sqrt(3.) - C_BL)*nu_w_km2); // eq. (20) for w
+        xi_p = -(1 - C_BLp*tau_p)/(1 + C_BLp*tau_p)*xi_p_km1
+             + sig_p*sqrt(2*tau_p/T_V)/(1 + C_BLp*tau_p) * (nu_p + nu_p_km1); // eq. (21)
+      }
       xi_q = -(1 - 4*b_w*C_BLq/M_PI/in.V)/(1 + 4*b_w*C_BLq/M_PI/in.V) * xi_q_km1
            + C_BLq/in.V/(1 + 4*b_w*C_BLq/M_PI/in.V) * (xi_w - xi_w_km1); // eq. (23)
       xi_r = - (1 - 3*b_w*C_BLr/M_PI/in.V)/(1 + 3*b_w*C_BLr/M_PI/in.V) * xi_r_km1
@@ -348,10 +544,12 @@ void FGWinds::Turbulence(double h)
     } else if (turbType == ttMilspec) {
       // the following is the MIL-STD-1797A formulation
       // as cited in Yeager's report
-      xi_u = (1 - T_V/tau_u)  *xi_u_km1 + sig_u*sqrt(2*T_V/tau_u)*nu_u;  // eq. (30)
-      xi_v = (1 - 2*T_V/tau_u)*xi_v_km1 + sig_u*sqrt(4*T_V/tau_u)*nu_v;  // eq. (31)
-      xi_w = (1 - 2*T_V/tau_w)*xi_w_km1 + sig_w*sqrt(4*T_V/tau_w)*nu_w;  // eq. (32)
-      xi_p = (1 - T_V/tau_p)  *xi_p_km1 + sig_p*sqrt(2*T_V/tau_p)*nu_p;  // eq. (33)
+      if (!TurbPrecomputed) {
+        xi_u = (1 - T_V/tau_u)  *xi_u_km1 + sig_u*sqrt(2*T_V/tau_u)*nu_u;  // eq. (30)
+        xi_v = (1 - 2*T_V/tau_u)*xi_v_km1 + sig_u*sqrt(4*T_V/tau_u)*nu_v;  // eq. (31)
+        xi_w = (1 - 2*T_V/tau_w)*xi_w_km1 + sig_w*sqrt(4*T_V/tau_w)*nu_w;  // eq. (32)
+        xi_p = (1 - T_V/tau_p)  *xi_p_km1 + sig_p*sqrt(2*T_V/tau_p)*nu_p;  // eq. (33)
+      }
       xi_q = (1 - T_V/tau_q)  *xi_q_km1 + M_PI/4/b_w*(xi_w - xi_w_km1);  // eq. (34)
       xi_r = (1 - T_V/tau_r)  *xi_r_km1 + M_PI/3/b_w*(xi_v - xi_v_km1);  // eq. (35)
     }
@@ -560,6 +758,26 @@ void FGWinds::bind(void)
   PropertyManager->Tie("atmosphere/turbulence/milspec/severity",
                        this, &FGWinds::GetProbabilityOfExceedence,
                              &FGWinds::SetProbabilityOfExceedence);
+  PropertyManager->Tie("atmosphere/turbulence/milspec/precomputed",
+                       this, &FGWinds::GetTurbPrecomputed,
+                             &FGWinds::SetTurbPrecomputed);
+
+  // Gridded wind field
+  PropertyManager->Tie("atmosphere/wind-field/time-offset-sec", this,
+                       &FGWinds::GetWindFieldTimeOffset,
+                       &FGWinds::SetWindFieldTimeOffset);
+  PropertyManager->Tie("atmosphere/wind-field/prefetch-horizon-sec", this,
+                       &FGWinds::GetWindFieldHorizon,
+                       &FGWinds::SetWindFieldHorizon);
+  PropertyManager->Tie("atmosphere/wind-field/gradients", this,
+                       &FGWinds::GetWindFieldGradients,
+                       &FGWinds::SetWindFieldGradients);
+  PropertyManager->Tie("atmosphere/wind-field/north-fps", this, eNorth, (PMF)&FGWinds::GetWindFieldNED);
+  PropertyManager->Tie("atmosphere/wind-field/east-fps",  this, eEast,  (PMF)&FGWinds::GetWindFieldNED);
+  PropertyManager->Tie("atmosphere/wind-field/down-fps",  this, eDown,  (PMF)&FGWinds::GetWindFieldNED);
+  PropertyManager->Tie("atmosphere/wind-field/p-rad_sec", this, eP, (PMF)&FGWinds::GetWindFieldPQR);
+  PropertyManager->Tie("atmosphere/wind-field/q-rad_sec", this, eQ, (PMF)&FGWinds::GetWindFieldPQR);
+  PropertyManager->Tie("atmosphere/wind-field/r-rad_sec", this, eR, (PMF)&FGWinds::GetWindFieldPQR);
 
   // Total, calculated winds (local navigational/geographic frame: N-E-D). Read only.
   PropertyManager->Tie("atmosphere/total-wind-north-fps", this, eNorth, (PMF)&FGWinds::GetTotalWindNED);
@@ -42,6 +42,7 @@ INCLUDES
 #include "math/FGColumnVector3.h"
 #include "math/FGMatrix33.h"
 #include "math/FGTable.h"
+#include "simgear/misc/sg_path.hxx"
 
 #include "JSBSim_api.h"
 
@@ -57,6 +58,9 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGWindField;
+class FGTurbulenceBank;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -105,6 +109,17 @@ CLASS DOCUMENTATION
           <td>6</td></tr>
     </table>
 
+    If <tt>atmosphere/turbulence/milspec/precomputed</tt> is set, the Milspec
+    and Tustin models read their velocities from Dryden sequences that are
+    generated once and shared by all the FDM instances of the process (see
+    FGTurbulenceBank), starting at a random offset drawn from the generator of
+    the FDM. No random number is drawn and no filter is run for the velocities
+    in each frame, which is cheaper when many aircraft fly in turbulence. The
+    Tustin model then uses the exact Dryden spectra of MIL-F-8785C and the
+    Milspec model the first order approximations of MIL-STD-1797A. The
+    rotation rates q and r are still filtered by each aircraft since they
+    depend on its wingspan.
+
     @see Yeager, Jessie C.: "Implementation and Testing of Turbulence Models for
          the F18-HARV" (<a
          href="http://ntrs.nasa.gov/archive/nasa/casi.ntrs.nasa.gov/19980028448_1998081596.pdf">
@@ -112,6 +127,16 @@ CLASS DOCUMENTATION
 
     @see MIL-F-8785C: Military Specification: Flying Qualities of Piloted Aircraft
 
+    A spatially varying wind can be loaded from a gridded wind field file with
+    LoadWindField() (see FGWindField for the file format). The field is
+    interpolated at the location of the aircraft and added to the total wind.
+    If <tt>atmosphere/wind-field/gradients</tt> is set, the field is also
+    sampled at the wing tips and at the horizontal tail and the rotation of the
+    air is added to the turbulence rotation rates. The field time is the
+    simulation time plus <tt>atmosphere/wind-field/time-offset-sec</tt>, and the
+    tiles of the file along the flight path are read ahead over
+    <tt>atmosphere/wind-field/prefetch-horizon-sec</tt> (60 by default).
+
 */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -178,6 +203,34 @@ public:
 
   virtual double GetWindspeed(void) const;
 
+  // WIND FIELD access functions
+
+  /** Loads a gridded wind field that is added to the wind.
+      @param file name of the wind field file
+      @return true if successful */
+  bool LoadWindField(const SGPath& file);
+
+  /// Removes the wind field.
+  void UnloadWindField(void);
+
+  /** Uses the same wind field as another instance, or none if it has none.
+      The file is mapped once and shared by both instances. The time offset,
+      the prefetch horizon and the gradients flag are copied as well.
+      @param source the instance to copy the wind field from */
+  void ShareWindField(const FGWinds* source);
+
+  /// Retrieves the wind field components at the aircraft location in NED frame.
+  const FGColumnVector3& GetWindFieldNED(void) const { return vWindFieldNED; }
+
+  /// Retrieves a wind field component at the aircraft location in NED frame.
+  double GetWindFieldNED(int idx) const { return vWindFieldNED(idx); }
+
+  /// Retrieves the rotation rates of the air due to the wind field gradients.
+  const FGColumnVector3& GetWindFieldPQR(void) const { return vWindFieldPQR; }
+
+  /// Retrieves a rotation rate of the air due to the wind field gradients.
+  double GetWindFieldPQR(int idx) const { return vWindFieldPQR(idx); }
+
   // GUST access functions
 
   /// Sets a gust component in NED frame.
@@ -223,6 +276,10 @@ public:
   virtual void   SetProbabilityOfExceedence( int idx) {probability_of_exceedence_index = idx;}
   virtual int    GetProbabilityOfExceedence() const { return probability_of_exceedence_index;}
 
+  /// Reads the Milspec and Tustin turbulence from precomputed sequences.
+  virtual void   SetTurbPrecomputed(int p) { TurbPrecomputed = p; }
+  virtual int    GetTurbPrecomputed() const { return TurbPrecomputed; }
+
   // Stores data defining a 1 - cosine gust profile that builds up, holds steady
   // and fades out over specified durations.
   struct OneMinusCosineProfile {
@@ -313,6 +370,8 @@ public:
     double longitude;
     double latitude;
     double planetRadius;
+    double HTailArm;
+    FGColumnVector3 vVel;
     FGMatrix33 Tl2b;
     FGMatrix33 Tw2b;
     double totalDeltaT;
@@ -338,6 +397,23 @@ private:
   double windspeed_at_20ft; ///< in ft/s
   int probability_of_exceedence_index; ///< this is bound as the severity property
   FGTable *POE_Table; ///< probability of exceedence table
+  // values of the previous time steps of the Dryden filters
+  double xi_u_km1, nu_u_km1;
+  double xi_v_km1, xi_v_km2, nu_v_km1, nu_v_km2;
+  double xi_w_km1, xi_w_km2, nu_w_km1, nu_w_km2;
+  double xi_p_km1, nu_p_km1;
+  double xi_q_km1, xi_r_km1;
+  // precomputed Dryden sequences and distance read on them (scale lengths)
+  FGTurbulenceBank* TurbBank;
+  int TurbPrecomputed;
+  bool TurbPhaseDrawn;
+  double TurbPhase[4];
+  // scale lengths (ft) and intensities (ft/s) of the Dryden spectra
+  struct DrydenScales {
+    double h, b_w, windspeed_at_20ft;
+    int severity;
+    double L_u, L_w, L_p, sig_u, sig_w, sig_p;
+  } TurbScales;
 
   double psiw;
   FGColumnVector3 vTotalWindNED;
@@ -347,7 +423,27 @@ private:
   FGColumnVector3 vBurstGust;
   FGColumnVector3 vTurbulenceNED;
 
+  FGWindField* WindField;
+  FGColumnVector3 vWindFieldNED;
+  FGColumnVector3 vWindFieldPQR;
+  double WindFieldTimeOffset;
+  double WindFieldHorizon;
+  double WindFieldPrefetchTime;
+  int WindFieldGradients;
+
   void Turbulence(double h);
+  void UpdateDrydenScales(double h, double b_w);
+  void AdvanceTurbulencePhase(int idx, double ds);
+  void SampleWindField(void);
+  bool SampleWindField(double x, double y, double z, double t,
+                       FGColumnVector3& wind) const;
+  double GetWindFieldTimeOffset(void) const { return WindFieldTimeOffset; }
+  void SetWindFieldTimeOffset(double t) { WindFieldTimeOffset = t; }
+  double GetWindFieldHorizon(void) const { return WindFieldHorizon; }
+  void SetWindFieldHorizon(double t) { WindFieldHorizon = t; }
+  int GetWindFieldGradients(void) const { return WindFieldGradients; }
+  void SetWindFieldGradients(int g) { WindFieldGradients = g; }
+  void ResetTurbulenceHistory(void);
   void UpDownBurst();
 
   void CosineGust();
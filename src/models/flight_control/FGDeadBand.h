@@ -95,6 +95,7 @@ public:
   ~FGDeadBand();
 
   bool Run(void);
+  bool IsStateless(void) const { return true; }
 
 private:
   double width;
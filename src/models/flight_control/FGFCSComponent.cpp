@@ -239,6 +239,7 @@ FGFCSComponent::~FGFCSComponent()
 
 void FGFCSComponent::ResetPastStates(void)
 {
+  Reads.Clear();
   index = 0;
   for (unsigned int i = 0; i < output_array.size(); ++i)
     output_array[i] = 0.0;
@@ -246,6 +247,37 @@ void FGFCSComponent::ResetPastStates(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGFCSComponent::RunIfChanged(void)
+{
+  if (!IsStateless()) return Run();
+
+  if (!Reads.Changed()) {
+    if (IsOutput) SetOutput();
+    return true;
+  }
+
+  bool result;
+  Reads.Begin();
+  try {
+    result = Run();
+  } catch (...) {
+    Reads.End();
+    Reads.Clear();
+    throw;
+  }
+  Reads.End();
+
+  // A component that reads its own output depends on its previous output.
+  bool feedback = Reads.Contains(treenode);
+  for (unsigned int i=0; i<OutputNodes.size() && !feedback; i++)
+    feedback = Reads.Contains(OutputNodes[i]);
+  if (feedback) Reads.Clear();
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFCSComponent::SetOutput(void)
 {
   for (unsigned int i=0; i<OutputNodes.size(); i++) OutputNodes[i]->setDoubleValue(Output);
@@ -298,6 +330,7 @@ void FGFCSComponent::bind(void)
     tmp = Name;
   }
   PropertyManager->Tie( tmp, this, &FGFCSComponent::GetOutput);
+  treenode = PropertyManager->GetNode(tmp);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
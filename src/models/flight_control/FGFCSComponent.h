@@ -84,6 +84,11 @@ CLASS DOCUMENTATION
     - FGWwaypoint
     - FGAngle
 
+    When the property simulation/change-driven is set, the components whose
+    output only depends on the current value of their inputs (IsStateless()
+    returns true) are not run if none of the properties they read has changed
+    since they were last run: only their output properties are refreshed.
+
     @author Jon S. Berndt
     @version $Id: FGFCSComponent.h,v 1.28 2016/02/27 16:54:16 bcoconni Exp $
     @see Documentation for the FGFCS class, and for the configuration file class
@@ -102,6 +107,12 @@ public:
   virtual ~FGFCSComponent();
 
   virtual bool Run(void) { return true; }
+  /** Runs the component if it has a state or if one of the properties it read
+      during its last run has changed since. */
+  bool RunIfChanged(void);
+  /** Tells if the output of the component only depends on the current value
+      of the properties it reads. */
+  virtual bool IsStateless(void) const { return false; }
   virtual void SetOutput(void);
   void SetDtForFrameCount(int FrameCount);
   double GetOutput (void) const {return Output;}
@@ -111,6 +122,8 @@ public:
   virtual void ResetPastStates(void);
 
 protected:
+  friend class FGFCSKernel;
+
   FGFCS* fcs;
   FGPropertyManager* PropertyManager;
   FGPropertyNode_ptr treenode;
@@ -136,6 +149,7 @@ protected:
   double dt;
   bool IsOutput;
   bool clip;
+  FGPropertyReads Reads;
 
   void Delay(void);
   void Clip(void);
@@ -120,6 +120,7 @@ public:
   ~FGFCSFunction();
 
   bool Run(void);
+  bool IsStateless(void) const { return !function->IsVolatile(); }
 
 private:
   FGFunction* function;
@@ -0,0 +1,311 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGFCSKernel.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Compiled execution of the components of an FCS channel
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iostream>
+#include <typeinfo>
+
+#include "FGFCSKernel.h"
+#include "FGGain.h"
+#include "FGSummer.h"
+#include "FGFilter.h"
+#include "FGPID.h"
+#include "FGSwitch.h"
+#include "math/FGPropertyValue.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+IDENT(IdSrc,"$Id: FGFCSKernel.cpp,v 1.0 2026/10/18 Outerra Exp $");
+IDENT(IdHdr,ID_FCSKERNEL);
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGFCSKernel::FGFCSKernel(const vector<FGFCSComponent*>& components,
+                         const OutputMap& outputs)
+  : NumCompiled(0)
+{
+  for (unsigned int i=0; i<components.size(); i++)
+    Compile(components[i], outputs);
+
+  Debug(0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGFCSKernel::~FGFCSKernel()
+{
+  Debug(1);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The property node of a component is tied to its output unless the name of
+// the component clashes with a property that was already tied. The binding is
+// therefore checked by changing the output temporarily.
+
+void FGFCSKernel::MapOutputs(const vector<FGFCSComponent*>& components,
+                             OutputMap& outputs)
+{
+  for (unsigned int i=0; i<components.size(); i++) {
+    FGFCSComponent* comp = components[i];
+    const SGPropertyNode* node = comp->treenode;
+
+    if (!node || !node->isTied()) continue;
+
+    double output = comp->Output;
+    comp->Output = 0.5;
+    bool bound = node->getDoubleValue() == 0.5;
+    comp->Output = -0.25;
+    bound = bound && node->getDoubleValue() == -0.25;
+    comp->Output = output;
+
+    if (bound) outputs[node] = &comp->Output;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Only the exact classes are compiled: a derived class could override Run().
+// The operands are listed in the order in which Run() reads them.
+
+void FGFCSKernel::Compile(FGFCSComponent* comp, const OutputMap& outputs)
+{
+  Op op;
+  op.Code = eCall;
+  op.Component = comp;
+  op.First = (unsigned int)Operands.size();
+  op.Count = 0;
+  op.Clip = comp->clip;
+
+  const type_info& type = typeid(*comp);
+  OpCode code = eCall;
+  bool compiled = true;
+
+  if (type == typeid(FGGain)) {
+    FGGain* gain = static_cast<FGGain*>(comp);
+
+    if (gain->Type == "PURE_GAIN") code = ePureGain;
+    else if (gain->Type == "SCHEDULED_GAIN") code = eScheduledGain;
+    else if (gain->Type == "AEROSURFACE_SCALE") code = eAeroScale;
+
+    compiled = !gain->InputNodes.empty()
+      && AddOperand(gain->InputNodes[0], gain->InputSigns[0], outputs);
+    if (compiled && gain->GainPropertyNode)
+      AddOperand(gain->GainPropertyNode.ptr(), gain->GainPropertySign, outputs);
+
+  } else if (type == typeid(FGSummer)) {
+    code = eSummer;
+    for (unsigned int i=0; compiled && i<comp->InputNodes.size(); i++)
+      compiled = AddOperand(comp->InputNodes[i], comp->InputSigns[i], outputs);
+
+  } else if (type == typeid(FGFilter) || type == typeid(FGPID)) {
+    code = type == typeid(FGFilter) ? eFilter : ePID;
+    compiled = !comp->InputNodes.empty()
+      && AddOperand(comp->InputNodes[0], comp->InputSigns[0], outputs);
+
+  } else if (type == typeid(FGSwitch)) {
+    code = eSwitch;
+  }
+
+  if (code != eCall && compiled) {
+    op.Code = code;
+    op.Count = (unsigned int)Operands.size() - op.First;
+    NumCompiled++;
+  } else
+    Operands.resize(op.First);
+
+  Ops.push_back(op);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The sign of the property value is folded in the sign of the input. Since it
+// is +1 or -1, the product is rounded exactly as in the components.
+
+bool FGFCSKernel::AddOperand(const FGPropertyValue* value, double sign,
+                             const OutputMap& outputs)
+{
+  const SGPropertyNode* node = 0;
+
+  try {
+    node = value->GetNode();
+  } catch (...) {
+    node = 0;
+  }
+
+  if (!node) return false; // Late bound property that does not exist yet
+
+  AddOperand(node, value->GetSign() * sign, outputs);
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSKernel::AddOperand(const SGPropertyNode* node, double sign,
+                             const OutputMap& outputs)
+{
+  Operand operand;
+  OutputMap::const_iterator it = outputs.find(node);
+
+  operand.Node = node;
+  operand.Value = it != outputs.end() ? it->second : 0;
+  operand.Sign = sign;
+  Operands.push_back(operand);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCSKernel::Run(void)
+{
+  for (unsigned int i=0; i<Ops.size(); i++) {
+    const Op& op = Ops[i];
+    const Operand* in = Operands.data() + op.First;
+    FGFCSComponent* comp = op.Component;
+
+    switch (op.Code) {
+    case eCall:
+      comp->Run();
+      continue;
+    case ePureGain:
+      {
+        FGGain* gain = static_cast<FGGain*>(comp);
+        gain->Input = in[0].Get();
+        if (op.Count > 1) gain->Gain = in[1].Get();
+        gain->Output = gain->Gain * gain->Input;
+      }
+      break;
+    case eScheduledGain:
+      {
+        FGGain* gain = static_cast<FGGain*>(comp);
+        gain->Input = in[0].Get();
+        if (op.Count > 1) gain->Gain = in[1].Get();
+        double SchedGain = gain->Table->GetValue();
+        gain->Output = gain->Gain * SchedGain * gain->Input;
+      }
+      break;
+    case eAeroScale:
+      {
+        FGGain* gain = static_cast<FGGain*>(comp);
+        double Input = gain->Input = in[0].Get();
+        if (op.Count > 1) gain->Gain = in[1].Get();
+        if (gain->ZeroCentered) {
+          if (Input == 0.0) {
+            gain->Output = 0.0;
+          } else if (Input > 0) {
+            gain->Output = (Input / gain->InMax) * gain->OutMax;
+          } else {
+            gain->Output = (Input / gain->InMin) * gain->OutMin;
+          }
+        } else {
+          gain->Output = gain->OutMin + ((Input - gain->InMin) / (gain->InMax - gain->InMin))
+                                        * (gain->OutMax - gain->OutMin);
+        }
+        gain->Output *= gain->Gain;
+      }
+      break;
+    case eSummer:
+      comp->Output = 0.0;
+      for (unsigned int j=0; j<op.Count; j++) comp->Output += in[j].Get();
+      comp->Output += static_cast<FGSummer*>(comp)->Bias;
+      break;
+    case eFilter:
+      {
+        FGFilter* filter = static_cast<FGFilter*>(comp);
+        if (!filter->Initialize) filter->Input = in[0].Get();
+        filter->Update();
+      }
+      break;
+    case ePID:
+      {
+        FGPID* pid = static_cast<FGPID*>(comp);
+        pid->Input = in[0].Get();
+        pid->Update();
+      }
+      break;
+    case eSwitch:
+      static_cast<FGSwitch*>(comp)->Update();
+      break;
+    }
+
+    if (op.Clip) comp->Clip();
+    if (comp->IsOutput) {
+      for (unsigned int j=0; j<comp->OutputNodes.size(); j++)
+        comp->OutputNodes[j]->setDoubleValue(comp->Output);
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//    The bitmasked value choices are as follows:
+//    unset: In this case (the default) JSBSim would only print
+//       out the normally expected messages, essentially echoing
+//       the config files as they are read. If the environment
+//       variable is not set, debug_lvl is set to 1 internally
+//    0: This requests JSBSim not to output any messages
+//       whatsoever.
+//    1: This value explicity requests the normal JSBSim
+//       startup messages
+//    2: This value asks for a message to be printed out when
+//       a class is instantiated
+//    4: When this value is set, a message is displayed when a
+//       FGModel object executes its Run() method
+//    8: When this value is set, various runtime state variables
+//       are printed out periodically
+//    16: When set various parameters are sanity checked and
+//       a message is printed out when they go out of bounds
+
+void FGFCSKernel::Debug(int from)
+{
+  if (debug_lvl <= 0) return;
+
+  if (debug_lvl & 1) { // Standard console startup message output
+  }
+  if (debug_lvl & 2 ) { // Instantiation/Destruction notification
+    if (from == 0) cout << "Instantiated: FGFCSKernel" << endl;
+    if (from == 1) cout << "Destroyed:    FGFCSKernel" << endl;
+  }
+  if (debug_lvl & 4 ) { // Run() method entry print for FGModel-derived objects
+  }
+  if (debug_lvl & 8 ) { // Runtime state variables
+  }
+  if (debug_lvl & 16) { // Sanity checking
+  }
+  if (debug_lvl & 64) {
+    if (from == 0) { // Constructor
+      cout << IdSrc << endl;
+      cout << IdHdr << endl;
+    }
+  }
+}
+}
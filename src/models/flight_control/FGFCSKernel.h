@@ -0,0 +1,163 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGFCSKernel.h
+ Author:       Outerra
+ Date started: 10/18/26
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGFCSKERNEL_H
+#define FGFCSKERNEL_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <vector>
+#include <unordered_map>
+
+#include "FGJSBBase.h"
+#include "simgear/props/props.hxx"
+
+#include "JSBSim_api.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+DEFINITIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define ID_FCSKERNEL "$Id: FGFCSKernel.h,v 1.0 2026/10/18 Outerra Exp $"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFCSComponent;
+class FGPropertyValue;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Compiled form of the components of a channel.
+
+    The components of a channel are lowered to a flat array of typed
+    operations which is executed in place of the virtual Run() methods. Gains,
+    summers, filters, PIDs and switches are compiled; the other components are
+    executed by calling their Run() method.
+
+    The decisions that FGFCSComponent::Run() takes at each frame are taken
+    once at compile time: the type of gain, whether the output is clipped,
+    where the inputs are read from. An input that is the output of another
+    component (of any channel) is read directly from the component instead of
+    going through the property tree. The other inputs are read from their
+    property node, the name of late bound properties being resolved once.
+
+    The arithmetic is performed in the same order as in the components, so
+    the results are identical to the interpreted execution.
+
+    There is no separate slot array: the Output member of each component is
+    its slot, and it is read in place by the operations that use it. Every
+    output is still written to the properties listed in the \<output>
+    elements because their readers (models, functions, scripts, output
+    directives, the application) cannot be enumerated. As a result, the
+    kernels save the virtual calls, the per frame decisions and the reads of
+    the tied properties, but not the property writes: FGFCS::Run() is from 2%
+    (ZLT-NT) to 44% (ah1s) faster, far from an order of magnitude.
+
+    The kernel refers to the components and must be discarded when they are
+    deleted or when a new definition is loaded.
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGFCSKernel : public FGJSBBase
+{
+public:
+  /// Maps the property node of a component to its output.
+  typedef std::unordered_map<const SGPropertyNode*, const double*> OutputMap;
+
+  /** Constructor
+      @param components components of the channel in execution order
+      @param outputs outputs of the components of all the channels, as built
+                     by MapOutputs() */
+  FGFCSKernel(const std::vector<FGFCSComponent*>& components,
+              const OutputMap& outputs);
+  ~FGFCSKernel();
+
+  /// Executes the components.
+  void Run(void);
+
+  /// Number of components that have been compiled (not called).
+  unsigned int GetNumCompiled(void) const { return NumCompiled; }
+
+  /** Adds the property nodes of the components to outputs. A node is only
+      added if it actually reflects the output of its component. */
+  static void MapOutputs(const std::vector<FGFCSComponent*>& components,
+                         OutputMap& outputs);
+
+private:
+  /// Source of an operand.
+  struct Operand {
+    const SGPropertyNode* Node;
+    const double* Value; // output of a component, or null to read Node
+    double Sign;
+
+    double Get(void) const {
+      return (Value ? *Value : Node->getDoubleValue()) * Sign;
+    }
+  };
+
+  enum OpCode {eCall, ePureGain, eScheduledGain, eAeroScale, eSummer, eFilter,
+               ePID, eSwitch};
+
+  struct Op {
+    OpCode Code;
+    FGFCSComponent* Component;
+    unsigned int First;  // index of the first operand
+    unsigned int Count;  // number of operands
+    bool Clip;
+  };
+
+  std::vector<Op> Ops;
+  std::vector<Operand> Operands;
+  unsigned int NumCompiled;
+
+  void Compile(FGFCSComponent* comp, const OutputMap& outputs);
+  bool AddOperand(const FGPropertyValue* value, double sign,
+                  const OutputMap& outputs);
+  void AddOperand(const SGPropertyNode* node, double sign,
+                  const OutputMap& outputs);
+  void Debug(int from);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
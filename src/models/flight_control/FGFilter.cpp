@@ -187,6 +187,21 @@ void FGFilter::CalculateDynamicFilters(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool FGFilter::Run(void)
+{
+  if (!Initialize) Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+
+  Update();
+
+  Clip();
+  if (IsOutput) SetOutput();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Computes the output from the current Input and updates the past states.
+
+void FGFilter::Update(void)
 {
   if (Initialize) {
 
@@ -195,8 +210,6 @@ bool FGFilter::Run(void)
 
   } else {
 
-    Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
-    
     if (DynamicFilter) CalculateDynamicFilters();
     
     switch (FilterType) {
@@ -232,11 +245,6 @@ bool FGFilter::Run(void)
   PreviousOutput1 = Output;
   PreviousInput2  = PreviousInput1;
   PreviousInput1  = Input;
-
-  Clip();
-  if (IsOutput) SetOutput();
-
-  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -254,6 +254,8 @@ public:
   enum {eLag, eLeadLag, eOrder2, eWashout, eIntegrator, eUnknown} FilterType;
 
 private:
+  friend class FGFCSKernel;
+
   double ca;
   double cb;
   double cc;
@@ -268,6 +270,7 @@ private:
   FGPropertyNode_ptr Trigger;
   FGPropertyNode_ptr PropertyNode[7];
   void CalculateDynamicFilters(void);
+  void Update(void);
   void ReadFilterCoefficients(Element* el, int index);
   bool DynamicFilter;
   void Debug(int from);
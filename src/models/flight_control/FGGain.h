@@ -224,8 +224,11 @@ public:
   ~FGGain();
 
   bool Run (void);
+  bool IsStateless(void) const { return true; }
 
 private:
+  friend class FGFCSKernel;
+
   FGTable* Table;
   FGPropertyNode_ptr GainPropertyNode;
   double GainPropertySign;
@@ -166,12 +166,25 @@ void FGPID::ResetPastStates(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool FGPID::Run(void )
+{
+  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
+
+  Update();
+
+  Clip();
+  if (IsOutput) SetOutput();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Computes the output from the current Input and updates the integrator.
+
+void FGPID::Update(void)
 {
   double I_out_delta = 0.0;
   double Dval = 0;
 
-  Input = InputNodes[0]->getDoubleValue() * InputSigns[0];
-
   if (KpPropertyNode != 0) Kp = KpPropertyNode->getDoubleValue() * KpPropertySign;
   if (KiPropertyNode != 0) Ki = KiPropertyNode->getDoubleValue() * KiPropertySign;
   if (KdPropertyNode != 0) Kd = KdPropertyNode->getDoubleValue() * KdPropertySign;
@@ -223,11 +236,6 @@ bool FGPID::Run(void )
 
   Input_prev = Input;
   Input_prev2 = Input_prev;
-
-  Clip();
-  if (IsOutput) SetOutput();
-
-  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
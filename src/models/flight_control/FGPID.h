@@ -143,6 +143,8 @@ public:
   }
 
 private:
+  friend class FGFCSKernel;
+
   double Kp, Ki, Kd;
   double I_out_total;
   double Input_prev, Input_prev2;
@@ -160,6 +162,7 @@ private:
   FGPropertyNode_ptr KdPropertyNode;
   FGPropertyNode_ptr ProcessVariableDot;
 
+  void Update(void);
   void Debug(int from);
 };
 }
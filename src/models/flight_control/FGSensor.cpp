@@ -41,7 +41,9 @@ INCLUDES
 #include <cstdlib>
 
 #include "FGSensor.h"
+#include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
+#include "models/FGFCS.h"
 
 using namespace std;
 
@@ -190,10 +192,12 @@ void FGSensor::Noise(void)
 {
   double random_value=0.0;
 
+  FGRandom& generator = fcs->GetExec()->GetRandom();
+
   if (DistributionType == eUniform) {
-    random_value = 2.0*(((double)rand()/(double)RAND_MAX) - 0.5);
+    random_value = generator.GetUniformSigned();
   } else {
-    random_value = GaussianRandomNumber();
+    random_value = generator.GetNormal();
   }
 
   switch( NoiseType ) {
@@ -120,8 +120,11 @@ public:
 
   /// The execution method for this FCS component.
   bool Run(void);
+  bool IsStateless(void) const { return true; }
 
 private:
+  friend class FGFCSKernel;
+
   double Bias;
   void Debug(int from);
 };
@@ -134,6 +134,19 @@ FGSwitch::~FGSwitch()
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 bool FGSwitch::Run(void )
+{
+  Update();
+
+  Clip();
+  if (IsOutput) SetOutput();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Selects the output from the tests and delays it if requested.
+
+void FGSwitch::Update(void)
 {
   bool pass = false;
   double default_output=0.0;
@@ -154,10 +167,6 @@ bool FGSwitch::Run(void )
   if (!pass) Output = default_output;
 
   if (delay != 0) Delay();
-  Clip();
-  if (IsOutput) SetOutput();
-
-  return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
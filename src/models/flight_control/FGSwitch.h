@@ -151,8 +151,10 @@ public:
   /** Executes the switch logic.
       @return true - always*/
   bool Run(void);
+  bool IsStateless(void) const { return delay == 0; }
 
 private:
+  friend class FGFCSKernel;
 
   struct test {
     FGCondition* condition;
@@ -203,6 +205,7 @@ private:
 
   std::vector <test*> tests;
 
+  void Update(void);
   void Debug(int from);
 };
 }
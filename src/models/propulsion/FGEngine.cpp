@@ -71,6 +71,10 @@ FGEngine::FGEngine(int engine_number, struct Inputs& input)
   MaxThrottle = 1.0;
   MinThrottle = 0.0;
   FuelDensity = 6.02;
+  PerformanceMode = false;
+  SecondaryRate = 10;
+  SecondaryCounter = 0;
+  SecondaryElapsed = SecondaryDeltaT = 0.0;
   Debug(0);
 }
 
@@ -95,6 +99,8 @@ void FGEngine::ResetToIC(void)
   FuelFlowRate = 0.0;
   FuelFreeze = false;
   FuelUsedLbs = 0.0;
+  SecondaryCounter = 0;
+  SecondaryElapsed = SecondaryDeltaT = 0.0;
   Thruster->ResetToIC();
 }
 
@@ -110,6 +116,26 @@ double FGEngine::CalcFuelNeed(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGEngine::UpdateSecondary(void)
+{
+  if ((!PerformanceMode && !in.PerformanceMode) || in.TotalDeltaT == 0.0) {
+    SecondaryCounter = 0;
+    SecondaryElapsed = 0.0;
+    SecondaryDeltaT = in.TotalDeltaT;
+    return true;
+  }
+
+  SecondaryElapsed += in.TotalDeltaT;
+  if (++SecondaryCounter < SecondaryRate) return false;
+
+  SecondaryDeltaT = SecondaryElapsed;
+  SecondaryCounter = 0;
+  SecondaryElapsed = 0.0;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 unsigned int FGEngine::GetSourceTank(unsigned int i) const
 {
   if (i < SourceTanks.size()) {
@@ -205,7 +231,7 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
 
   Name = engine_element->GetAttributeValue("name");
 
-  FGModelFunctions::Load(engine_element, PropertyManager, to_string((int)EngineNumber)); // Call ModelFunctions loader
+  FGModelFunctions::Load(engine_element, exec, to_string((int)EngineNumber)); // Call ModelFunctions loader
 
 // Find and set engine location
 
@@ -256,8 +282,12 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
   PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetFuelFlowRateGPH);
   property_name = base_property_name + "/fuel-used-lbs";
   PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetFuelUsedLbs);
+  property_name = base_property_name + "/performance-mode";
+  PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetPerformanceMode, &FGEngine::SetPerformanceMode);
+  property_name = base_property_name + "/secondary-rate";
+  PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetSecondaryRate, &FGEngine::SetSecondaryRate);
 
-  PostLoad(engine_element, PropertyManager, to_string((int)EngineNumber));
+  PostLoad(engine_element, exec, to_string((int)EngineNumber));
 
   Debug(0);
 
@@ -112,6 +112,17 @@ CLASS DOCUMENTATION
   Not all thruster types can be matched with a given engine type.  See the class
   documentation for engine and thruster classes.
 </pre>     
+    <h3>Performance mode:</h3>
+
+    When propulsion/engine[n]/performance-mode is set (or when the level of
+    detail of the executive is eLODMinimal), the quantities that vary slowly -
+    the temperatures and pressures of the piston engine, the thrust tables of
+    the turbine and the flight condition correction of the turboprop - are only
+    updated every propulsion/engine[n]/secondary-rate (default 10) executions
+    of the engine, and are integrated over the elapsed time. The thrust, the
+    power and the fuel flow are still computed at every execution. Trimming
+    always updates every quantity.
+
     @author Jon S. Berndt
     @version $Id: FGEngine.h,v 1.48 2017/03/03 23:00:39 bcoconni Exp $
 */
@@ -148,6 +159,7 @@ public:
     std::vector <double> PropAdvance;
     std::vector <bool> PropFeather;
     double TotalDeltaT;
+    bool PerformanceMode;   // forces all the engines in performance mode
   };
 
   FGEngine(int engine_number, struct Inputs& input);
@@ -182,6 +194,14 @@ public:
 
   virtual void SetStarter(bool s) { Starter = s; }
 
+  /** In performance mode the secondary quantities of the engine (the
+      temperatures, the pressures and the terms that only depend on the flight
+      condition) are only updated every SecondaryRate calls to Calculate(). */
+  bool GetPerformanceMode(void) const { return PerformanceMode; }
+  void SetPerformanceMode(bool mode) { PerformanceMode = mode; }
+  int GetSecondaryRate(void) const { return SecondaryRate; }
+  void SetSecondaryRate(int rate) { SecondaryRate = rate < 1 ? 1 : rate; }
+
   virtual int InitRunning(void){ return 1; }
 
   /** Resets the Engine parameters to the initial conditions */
@@ -241,6 +261,12 @@ protected:
   bool  Cranking;
   bool  FuelFreeze;
 
+  bool  PerformanceMode;
+  int   SecondaryRate;
+  int   SecondaryCounter;
+  double SecondaryElapsed;
+  double SecondaryDeltaT;  // time elapsed since the last secondary update
+
   double FuelFlow_gph;
   double FuelFlow_pph;
   double FuelUsedLbs;
@@ -251,6 +277,10 @@ protected:
   std::vector <int> SourceTanks;
 
   virtual bool Load(FGFDMExec *exec, Element *el);
+  /** Tells whether the secondary quantities must be updated this frame and
+      sets SecondaryDeltaT to the time over which they must be integrated.
+      Always true outside of the performance mode and during the trim. */
+  bool UpdateSecondary(void);
   void Debug(int from);
 };
 }
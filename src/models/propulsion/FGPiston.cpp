@@ -508,10 +508,12 @@ void FGPiston::Calculate(void)
   doEnginePower();
   if (IndicatedHorsePower < 0.1250) Running = false;
 
-  doEGT();
-  doCHT();
-  doOilTemperature();
-  doOilPressure();
+  if (UpdateSecondary()) {
+    doEGT();
+    doCHT();
+    doOilTemperature();
+    doOilPressure();
+  }
 
   if (Thruster->GetType() == FGThruster::ttPropeller) {
     ((FGPropeller*)Thruster)->SetAdvance(in.PropAdvance[EngineNumber]);
@@ -845,7 +847,7 @@ void FGPiston::doEGT(void)
   } else {  // Drop towards ambient - guess an appropriate time constant for now
     combustion_efficiency = 0;
     dEGTdt = (RankineToKelvin(in.Temperature) - ExhaustGasTemp_degK) / 100.0;
-    delta_T_exhaust = dEGTdt * in.TotalDeltaT;
+    delta_T_exhaust = dEGTdt * SecondaryDeltaT;
 
     ExhaustGasTemp_degK += delta_T_exhaust;
   }
@@ -885,7 +887,7 @@ void FGPiston::doCHT(void)
   double HeatCapacityCylinderHead = CpCylinderHead * MassCylinderHead;
 
   CylinderHeadTemp_degK +=
-    (dqdt_cylinder_head / HeatCapacityCylinderHead) * in.TotalDeltaT;
+    (dqdt_cylinder_head / HeatCapacityCylinderHead) * SecondaryDeltaT;
 
 }
 
@@ -920,7 +922,7 @@ void FGPiston::doOilTemperature(void)
 
   double dOilTempdt = (target_oil_temp - OilTemp_degK) / time_constant;
 
-  OilTemp_degK += (dOilTempdt * in.TotalDeltaT);
+  OilTemp_degK += (dOilTempdt * SecondaryDeltaT);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
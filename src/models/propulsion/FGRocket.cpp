@@ -97,7 +97,7 @@ FGRocket::FGRocket(FGFDMExec* exec, Element *el, int engine_number, struct Input
   if (isp_el) {
     Element* isp_func_el = isp_el->FindElement("function");
     if (isp_func_el) {
-      isp_function = new FGFunction(exec->GetPropertyManager(),isp_func_el, strEngineNumber.str());
+      isp_function = new FGFunction(exec, isp_func_el, strEngineNumber.str());
     } else {
     Isp = el->FindElementValueAsNumber("isp");
     }
@@ -85,8 +85,9 @@ FGRotor::FGRotor(FGFDMExec *exec, Element* rotor_element, int num)
     InflowLag(0.0), TipLossB(0.0),
     GroundEffectExp(0.0), GroundEffectShift(0.0), GroundEffectScaleNorm(1.0),
     LockNumberByRho(0.0), Solidity(0.0),            // derived parameters
+    BladeAreaRadius(0.0), HingeMomentFactor(0.0), InflowDecay(0.0),
     RPM(0.0), Omega(0.0),                           // dynamic values
-    beta_orient(0.0),
+    beta_orient(0.0), cos_beta(1.0), sin_beta(0.0),
     a0(0.0), a_1(0.0), b_1(0.0), a_dw(0.0),
     a1s(0.0), b1s(0.0),
     H_drag(0.0), J_side(0.0), Torque(0.0), C_T(0.0),
@@ -348,6 +349,11 @@ double FGRotor::Configure(Element* rotor_element)
   InflowLag = ConfigValue(rotor_element, "inflowlag", estimate, yell);
   InflowLag = Constrain(1e-6, InflowLag, 2.0);
 
+  // configuration constant factors of the per-frame calculations
+  BladeAreaRadius = BladeNum*BladeChord*Radius;
+  HingeMomentFactor = 0.5 * HingeOffset * BladeNum;
+  InflowDecay = exp(-dt/InflowLag);
+
   return engine_power_est;
 } // Configure
 
@@ -366,11 +372,13 @@ FGColumnVector3 FGRotor::hub_vel_body2ca( const FGColumnVector3 &uvw,
   pos = fdmex->GetMassBalance()->StructuralToBody(GetActingLocation());
 
   v_r = uvw + pqr*pos;
-  v_shaft = TboToHsr * InvTransform * v_r;
+  v_shaft = BodyToShaft * v_r;
 
   beta_orient = atan2(v_shaft(eV),v_shaft(eU));
+  cos_beta = cos(beta_orient);
+  sin_beta = sin(beta_orient);
 
-  v_w(eU) = v_shaft(eU)*cos(beta_orient) + v_shaft(eV)*sin(beta_orient);
+  v_w(eU) = v_shaft(eU)*cos_beta + v_shaft(eV)*sin_beta;
   v_w(eV) = 0.0;
   v_w(eW) = v_shaft(eW) - b_ic*v_shaft(eU) - a_ic*v_shaft(eV);
 
@@ -388,10 +396,10 @@ FGColumnVector3 FGRotor::fus_angvel_body2ca( const FGColumnVector3 &pqr)
   // for comparison:
   // av_s_fus = BodyToShaft * pqr; /SH79/
   // BodyToShaft = TboToHsr * InvTransform
-  av_s_fus = TboToHsr * InvTransform * pqr;
+  av_s_fus = BodyToShaft * pqr;
 
-  av_w_fus(eP)=   av_s_fus(eP)*cos(beta_orient) + av_s_fus(eQ)*sin(beta_orient);
-  av_w_fus(eQ)= - av_s_fus(eP)*sin(beta_orient) + av_s_fus(eQ)*cos(beta_orient);
+  av_w_fus(eP)=   av_s_fus(eP)*cos_beta + av_s_fus(eQ)*sin_beta;
+  av_w_fus(eQ)= - av_s_fus(eP)*sin_beta + av_s_fus(eQ)*cos_beta;
   av_w_fus(eR)=   av_s_fus(eR);
 
   return av_w_fus;
@@ -431,7 +439,7 @@ void FGRotor::calc_flow_and_thrust( double theta_0, double Uw, double Ww,
   // ref: dnu/dt = 1/tau ( Ct / (2*sqrt(mu^2+lambda^2))  -  nu )
   // taking mu and lambda constant, this integrates to
 
-  nu  = flow_scale * ((nu - c0) * exp(-dt/InflowLag) + c0);
+  nu  = flow_scale * ((nu - c0) * InflowDecay + c0);
 
   // now from nu to lambda, C_T, and Thrust
 
@@ -441,7 +449,7 @@ void FGRotor::calc_flow_and_thrust( double theta_0, double Uw, double Ww,
 
   ct_over_sigma = (LiftCurveSlope/2.0)*(ct_l + ct_t0 + ct_t1); // /SH79/ eqn(27)
 
-  Thrust = BladeNum*BladeChord*Radius*rho*sqr(Omega*Radius) * ct_over_sigma;
+  Thrust = BladeAreaRadius*rho*sqr(Omega*Radius) * ct_over_sigma;
 
   C_T = ct_over_sigma * Solidity;
   v_induced = nu * (Omega*Radius);
@@ -517,7 +525,7 @@ void FGRotor::calc_drag_and_side_forces(double theta_0)
                   );
   cy_over_sigma *= LiftCurveSlope/2.0;
 
-  J_side = BladeNum * BladeChord * Radius * rho * sqr(Omega*Radius) * cy_over_sigma;
+  J_side = BladeAreaRadius * rho * sqr(Omega*Radius) * cy_over_sigma;
 
   return;
 }
@@ -551,7 +559,7 @@ void FGRotor::calc_torque(double theta_0)
 void FGRotor::calc_downwash_angles()
 {
   FGColumnVector3 v_shaft;
-  v_shaft = TboToHsr * InvTransform * in.AeroUVW;
+  v_shaft = BodyToShaft * in.AeroUVW;
 
   theta_downwash = atan2( -v_shaft(eU), v_induced - v_shaft(eW)) + a1s;
   phi_downwash   = atan2(  v_shaft(eV), v_induced - v_shaft(eW)) + b1s;
@@ -567,8 +575,8 @@ void FGRotor::calc_downwash_angles()
 FGColumnVector3 FGRotor::body_forces(double a_ic, double b_ic)
 {
   FGColumnVector3 F_s(
-        - H_drag*cos(beta_orient) - J_side*sin(beta_orient) + Thrust*b_ic,
-        - H_drag*sin(beta_orient) + J_side*cos(beta_orient) + Thrust*a_ic,
+        - H_drag*cos_beta - J_side*sin_beta + Thrust*b_ic,
+        - H_drag*sin_beta + J_side*cos_beta + Thrust*a_ic,
         - Thrust);
 
   return HsrToTbo * F_s;
@@ -585,10 +593,10 @@ FGColumnVector3 FGRotor::body_moments(double a_ic, double b_ic)
   double mf;
 
   // cyclic flapping relative to shaft axes /SH79/ eqn(43)
-  a1s = a_1*cos(beta_orient) + b_1*sin(beta_orient) - b_ic;
-  b1s = b_1*cos(beta_orient) - a_1*sin(beta_orient) + a_ic;
+  a1s = a_1*cos_beta + b_1*sin_beta - b_ic;
+  b1s = b_1*cos_beta - a_1*sin_beta + a_ic;
 
-  mf = 0.5 * HingeOffset * BladeNum * Omega*Omega * BladeMassMoment;
+  mf = HingeMomentFactor * Omega*Omega * BladeMassMoment;
 
   M_s(eL) = mf*b1s;
   M_s(eM) = mf*a1s;
@@ -616,6 +624,7 @@ void FGRotor::CalcRotorState(void)
 
   // update InvTransform, the rotor orientation could have been altered
   InvTransform = Transform().Transposed();
+  BodyToShaft = TboToHsr * InvTransform;
 
   // handle RPM requirements, calc omega.
   if (ExternalRPM && ExtRPMsource) {
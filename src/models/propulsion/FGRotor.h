@@ -395,6 +395,9 @@ private:
   double Solidity; // aka sigma
   double R[5]; // Radius powers
   double B[5]; // TipLossB powers
+  double BladeAreaRadius;   // BladeNum*BladeChord*Radius
+  double HingeMomentFactor; // 0.5*HingeOffset*BladeNum
+  double InflowDecay;       // exp(-dt/InflowLag), inflow lag over a time step
 
   // Some of the calculations require shaft axes. So the
   // thruster orientation (Tbo, with b for body) needs to be
@@ -402,11 +405,13 @@ private:
   FGMatrix33 InvTransform;
   FGMatrix33 TboToHsr;
   FGMatrix33 HsrToTbo;
+  FGMatrix33 BodyToShaft; // TboToHsr * InvTransform, updated each frame
 
   // dynamic values
   double RPM;
   double Omega;          // must be > 0 
   double beta_orient;    // rotor orientation angle (rad)
+  double cos_beta, sin_beta;
   double a0;             // coning angle (rad)
   double a_1, b_1, a_dw; // flapping angles
   double a1s, b1s;       // cyclic flapping relative to shaft axes, /SH79/ eqn(43)
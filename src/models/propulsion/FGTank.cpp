@@ -146,7 +146,7 @@ FGTank::FGTank(FGFDMExec* exec, Element* el, int tank_number)
         Element* element_ixx = element_Grain->FindElement("ixx");
         if (element_ixx->GetAttributeValue("unit") == "KG*M2") ixx_unit = 1.0/1.35594;
         if (element_ixx->FindElement("function") != 0) {
-          function_ixx = new FGFunction(PropertyManager, element_ixx->FindElement("function"));
+          function_ixx = new FGFunction(exec, element_ixx->FindElement("function"));
         }
       } else {
         throw("For tank "+to_string(TankNumber)+" and when grain_config is specified an ixx must be specified when the FUNCTION grain type is specified.");
@@ -156,7 +156,7 @@ FGTank::FGTank(FGFDMExec* exec, Element* el, int tank_number)
         Element* element_iyy = element_Grain->FindElement("iyy");
         if (element_iyy->GetAttributeValue("unit") == "KG*M2") iyy_unit = 1.0/1.35594;
         if (element_iyy->FindElement("function") != 0) {
-          function_iyy = new FGFunction(PropertyManager, element_iyy->FindElement("function"));
+          function_iyy = new FGFunction(exec, element_iyy->FindElement("function"));
         }
       } else {
         throw("For tank "+to_string(TankNumber)+" and when grain_config is specified an iyy must be specified when the FUNCTION grain type is specified.");
@@ -166,7 +166,7 @@ FGTank::FGTank(FGFDMExec* exec, Element* el, int tank_number)
         Element* element_izz = element_Grain->FindElement("izz");
         if (element_izz->GetAttributeValue("unit") == "KG*M2") izz_unit = 1.0/1.35594;
         if (element_izz->FindElement("function") != 0) {
-          function_izz = new FGFunction(PropertyManager, element_izz->FindElement("function"));
+          function_izz = new FGFunction(exec, element_izz->FindElement("function"));
         }
       } else {
         throw("For tank "+to_string(TankNumber)+" and when grain_config is specified an izz must be specified when the FUNCTION grain type is specified.");
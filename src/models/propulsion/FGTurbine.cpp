@@ -107,6 +107,7 @@ void FGTurbine::ResetToIC(void)
   phase = tpOff;
   EGT_degC = in.TAT_c;
   OilTemp_degK = in.TAT_c + 273.0;
+  FlightConditionValid = false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -119,6 +120,10 @@ void FGTurbine::Calculate(void)
 
   RunPreFunctions();
 
+  // The flight condition dependent terms of the run phase are evaluated at
+  // the secondary rate in performance mode, and when the phase is entered.
+  if (UpdateSecondary() || phase != tpRun) FlightConditionValid = false;
+
   ThrottlePos = in.ThrottlePos[EngineNumber];
 
   if (ThrottlePos > 1.0) {
@@ -197,13 +202,17 @@ double FGTurbine::Off(void)
 
 double FGTurbine::Run()
 {
-  double idlethrust, milthrust, thrust;
+  double thrust;
   double spoolup;                        // acceleration in pct/sec
   double sigma = in.DensityRatio;
-  double T = in.Temperature;
 
-  idlethrust = MilThrust * IdleThrustLookup->GetValue();
-  milthrust = (MilThrust - idlethrust) * MilThrustLookup->GetValue();
+  if (!FlightConditionValid) {
+    IdleThrust = MilThrust * IdleThrustLookup->GetValue();
+    MilThrustExcess = (MilThrust - IdleThrust) * MilThrustLookup->GetValue();
+    TSFCTempFactor = sqrt(in.Temperature/389.7);
+    OilTemp_degK = Seek(&OilTemp_degK, 366.0, 1.2, 0.1, SecondaryDeltaT);
+    FlightConditionValid = true;
+  }
 
   Running = true;
   Starter = false;
@@ -221,13 +230,12 @@ double FGTurbine::Run()
   N2 = Seek(&N2, IdleN2 + ThrottlePos * N2_factor, spoolup, spoolup * 3.0);
   N1 = Seek(&N1, IdleN1 + ThrottlePos * N1_factor, spoolup, spoolup * 2.4);
   N2norm = (N2 - IdleN2) / N2_factor;
-  thrust = idlethrust + (milthrust * N2norm * N2norm);
+  thrust = IdleThrust + (MilThrustExcess * N2norm * N2norm);
   EGT_degC = in.TAT_c + 363.1 + ThrottlePos * 357.1;
   OilPressure_psi = N2 * 0.62;
-  OilTemp_degK = Seek(&OilTemp_degK, 366.0, 1.2, 0.1);
 
   if (!Augmentation) {
-    correctedTSFC = TSFC * sqrt(T/389.7) * (0.84 + (1-N2norm)*(1-N2norm));
+    correctedTSFC = TSFC * TSFCTempFactor * (0.84 + (1-N2norm)*(1-N2norm));
     FuelFlow_pph = Seek(&FuelFlow_pph, thrust * correctedTSFC, 1000.0, 10000.0);
     if (FuelFlow_pph < IdleFF) FuelFlow_pph = IdleFF;
     NozzlePosition = Seek(&NozzlePosition, 1.0 - N2norm, 0.8, 0.8);
@@ -405,12 +413,19 @@ double FGTurbine::GetPowerAvailable(void) {
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTurbine::Seek(double *var, double target, double accel, double decel) {
+  return Seek(var, target, accel, decel, in.TotalDeltaT);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTurbine::Seek(double *var, double target, double accel, double decel,
+                       double dt) {
   double v = *var;
   if (v > target) {
-    v -= in.TotalDeltaT * decel;
+    v -= dt * decel;
     if (v < target) v = target;
   } else if (v < target) {
-    v += in.TotalDeltaT * accel;
+    v += dt * accel;
     if (v > target) v = target;
   }
   return v;
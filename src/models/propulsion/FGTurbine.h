@@ -182,6 +182,9 @@ public:
       @param accel the rate, per second, the value may increase
       @param decel the rate, per second, the value may decrease    */
   double Seek(double* var, double target, double accel, double decel);
+  /// Same as Seek() over the time step dt.
+  double Seek(double* var, double target, double accel, double decel,
+              double dt);
 
   phaseType GetPhase(void) { return phase; }
 
@@ -276,6 +279,10 @@ private:
   double InletPosition;
   double NozzlePosition;
   double correctedTSFC;
+  double IdleThrust;       ///< idle thrust (lbs) at the flight condition
+  double MilThrustExcess;  ///< mil thrust above idle (lbs) at the flight condition
+  double TSFCTempFactor;   ///< temperature correction of the TSFC
+  bool FlightConditionValid; ///< the three terms above are up to date
   double InjectionTimer;
   double InjectionTime;
   double InjWaterNorm;
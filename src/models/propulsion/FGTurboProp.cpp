@@ -200,6 +200,10 @@ void FGTurboProp::Calculate(void)
 {
   RunPreFunctions();
 
+  // The flight condition dependent terms of the run phase are evaluated at
+  // the secondary rate in performance mode, and when the phase is entered.
+  if (UpdateSecondary() || phase != tpRun) FlightConditionValid = false;
+
   ThrottlePos = in.ThrottlePos[EngineNumber];
 
   /* The thruster controls the engine RPM because it encapsulates the gear ratio
@@ -327,6 +331,7 @@ double FGTurboProp::Off(void)
 double FGTurboProp::Run(void)
 {
   double EngPower_HP;
+  bool secondary = !FlightConditionValid;
 
   Running = true; Starter = false; EngStarting = false;
 
@@ -335,7 +340,11 @@ double FGTurboProp::Run(void)
   N1 = ExpSeek(&N1, IdleN1 + ThrottlePos * N1_factor, Idle_Max_Delay, Idle_Max_Delay * 2.4);
 
   EngPower_HP = EnginePowerRPM_N1->GetValue(RPM,N1);
-  EngPower_HP *= EnginePowerVC->GetValue();
+  if (secondary) {
+    PowerVCFactor = EnginePowerVC->GetValue();
+    FlightConditionValid = true;
+  }
+  EngPower_HP *= PowerVCFactor;
   if (EngPower_HP > MaxPower) EngPower_HP = MaxPower;
 
   CombustionEfficiency = CombustionEfficiency_N1->GetValue(N1);
@@ -348,7 +357,9 @@ double FGTurboProp::Run(void)
   OilPressure_psi = (N1/100.0*0.25+(0.1-(OilTemp_degK-273.15)*0.1/80.0)*N1/100.0) / 7692.0e-6; //from MPa to psi
 //---
 
-  OilTemp_degK = Seek(&OilTemp_degK, 353.15, 0.4-N1*0.001, 0.04);
+  if (secondary)
+    OilTemp_degK = Seek(&OilTemp_degK, 353.15, 0.4-N1*0.001, 0.04,
+                        SecondaryDeltaT);
 
   if (Cutoff) phase = tpOff;
   if (Starved) phase = tpOff;
@@ -447,13 +458,21 @@ double FGTurboProp::CalcFuelNeed(void)
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTurboProp::Seek(double *var, double target, double accel, double decel)
+{
+  return Seek(var, target, accel, decel, in.TotalDeltaT);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTurboProp::Seek(double *var, double target, double accel, double decel,
+                         double dt)
 {
   double v = *var;
   if (v > target) {
-    v -= in.TotalDeltaT * decel;
+    v -= dt * decel;
     if (v < target) v = target;
   } else if (v < target) {
-    v += in.TotalDeltaT * accel;
+    v += dt * accel;
     if (v > target) v = target;
   }
   return v;
@@ -499,6 +518,8 @@ void FGTurboProp::SetDefaults(void)
   ReverseMaxPower = 0.0;
   BetaRangeThrottleEnd = 0.0;
   CombustionEfficiency = 1.0;
+  PowerVCFactor = 1.0;
+  FlightConditionValid = false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -114,6 +114,9 @@ public:
   bool GetIeluIntervent(void) const { return Ielu_intervent; }
 
   double Seek(double* var, double target, double accel, double decel);
+  /// Same as Seek() over the time step dt.
+  double Seek(double* var, double target, double accel, double decel,
+              double dt);
   double ExpSeek(double* var, double target, double accel, double decel);
 
   phaseType GetPhase(void) const { return phase; }
@@ -170,6 +173,8 @@ private:
   double RPM;                  // shaft RPM
   double PSFC;                 // Power specific fuel comsumption [lb/(HP*hr)] at best efficiency
   double CombustionEfficiency;
+  double PowerVCFactor;        // power correction for the flight condition
+  bool FlightConditionValid;   // PowerVCFactor is up to date
 
   double HP;                   // engine power output
 
@@ -19,6 +19,7 @@
 #include <sstream>
 #include <iomanip>
 #include <iterator>
+#include <atomic>
 #include <stdio.h>
 #include <string.h>
 
@@ -54,6 +55,38 @@ using std::stringstream;
 
 using namespace simgear;
 
+////////////////////////////////////////////////////////////////////////
+// Read logs.
+////////////////////////////////////////////////////////////////////////
+
+// Log of the calling thread and number of threads with a log, which saves
+// the access to the thread local storage when no log is in use.
+static thread_local SGPropertyNode::ReadLog* read_log = 0;
+static std::atomic<int> read_logs(0);
+
+SGPropertyNode::ReadLog*
+SGPropertyNode::setReadLog (ReadLog* log)
+{
+  ReadLog* previous = read_log;
+  if (log && !previous) read_logs++;
+  else if (!log && previous) read_logs--;
+  read_log = log;
+  return previous;
+}
+
+SGPropertyNode::ReadLog*
+SGPropertyNode::getReadLog ()
+{
+  return read_log;
+}
+
+void
+SGPropertyNode::log_read () const
+{
+  if (read_log) read_log->push_back(this);
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 // Local classes.
 ////////////////////////////////////////////////////////////////////////
@@ -617,12 +650,14 @@ SGPropertyNode::set_bool (bool val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<bool>*>(_value.val)->setValue(val)) {
+      _version++;
       fireValueChanged();
       return true;
     } else {
       return false;
     }
   } else {
+    if (_local_val.bool_val != val) _version++;
     _local_val.bool_val = val;
     fireValueChanged();
     return true;
@@ -634,12 +669,14 @@ SGPropertyNode::set_int (int val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<int>*>(_value.val)->setValue(val)) {
+      _version++;
       fireValueChanged();
       return true;
     } else {
       return false;
     }
   } else {
+    if (_local_val.int_val != val) _version++;
     _local_val.int_val = val;
     fireValueChanged();
     return true;
@@ -651,12 +688,14 @@ SGPropertyNode::set_long (long val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<long>*>(_value.val)->setValue(val)) {
+      _version++;
       fireValueChanged();
       return true;
     } else {
       return false;
     }
   } else {
+    if (_local_val.long_val != val) _version++;
     _local_val.long_val = val;
     fireValueChanged();
     return true;
@@ -668,12 +707,14 @@ SGPropertyNode::set_float (float val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<float>*>(_value.val)->setValue(val)) {
+      _version++;
       fireValueChanged();
       return true;
     } else {
       return false;
     }
   } else {
+    if (_local_val.float_val != val) _version++;
     _local_val.float_val = val;
     fireValueChanged();
     return true;
@@ -685,12 +726,14 @@ SGPropertyNode::set_double (double val)
 {
   if (_tied) {
     if (static_cast<SGRawValue<double>*>(_value.val)->setValue(val)) {
+      _version++;
       fireValueChanged();
       return true;
     } else {
       return false;
     }
   } else {
+    if (_local_val.double_val != val) _version++;
     _local_val.double_val = val;
     fireValueChanged();
     return true;
@@ -702,12 +745,15 @@ SGPropertyNode::set_string (const char * val)
 {
   if (_tied) {
       if (static_cast<SGRawValue<const char*>*>(_value.val)->setValue(val)) {
+      _version++;
       fireValueChanged();
       return true;
     } else {
       return false;
     }
   } else {
+    if (!_local_val.string_val || !val || strcmp(_local_val.string_val, val))
+      _version++;
     delete [] _local_val.string_val;
     _local_val.string_val = copy_string(val);
     fireValueChanged();
@@ -718,6 +764,7 @@ SGPropertyNode::set_string (const char * val)
 void
 SGPropertyNode::clearValue ()
 {
+    _version++;
     if (_type == props::ALIAS) {
         put(_value.alias);
         _value.alias = 0;
@@ -846,6 +893,7 @@ SGPropertyNode::SGPropertyNode ()
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
+    _version(0),
     _listeners(0)
 {
   _local_val.string_val = 0;
@@ -864,6 +912,7 @@ SGPropertyNode::SGPropertyNode (const SGPropertyNode &node)
     _type(node._type),
     _tied(node._tied),
     _attr(node._attr),
+    _version(0),
     _listeners(0)		// CHECK!!
 {
   _local_val.string_val = 0;
@@ -919,6 +968,7 @@ SGPropertyNode::SGPropertyNode (Itr begin, Itr end,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
+    _version(0),
     _listeners(0)
 {
   _local_val.string_val = 0;
@@ -936,6 +986,7 @@ SGPropertyNode::SGPropertyNode( const std::string& name,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
+    _version(0),
     _listeners(0)
 {
   _local_val.string_val = 0;
@@ -1312,6 +1363,7 @@ SGPropertyNode::getType () const
 bool 
 SGPropertyNode::getBoolValue () const
 {
+  if (read_logs.load(std::memory_order_relaxed)) log_read();
 				// Shortcut for common case
   if (_attr == (READ|WRITE) && _type == props::BOOL)
     return get_bool();
@@ -1345,6 +1397,7 @@ SGPropertyNode::getBoolValue () const
 int 
 SGPropertyNode::getIntValue () const
 {
+  if (read_logs.load(std::memory_order_relaxed)) log_read();
 				// Shortcut for common case
   if (_attr == (READ|WRITE) && _type == props::INT)
     return get_int();
@@ -1378,6 +1431,7 @@ SGPropertyNode::getIntValue () const
 long 
 SGPropertyNode::getLongValue () const
 {
+  if (read_logs.load(std::memory_order_relaxed)) log_read();
 				// Shortcut for common case
   if (_attr == (READ|WRITE) && _type == props::LONG)
     return get_long();
@@ -1411,6 +1465,7 @@ SGPropertyNode::getLongValue () const
 float 
 SGPropertyNode::getFloatValue () const
 {
+  if (read_logs.load(std::memory_order_relaxed)) log_read();
 				// Shortcut for common case
   if (_attr == (READ|WRITE) && _type == props::FLOAT)
     return get_float();
@@ -1444,6 +1499,7 @@ SGPropertyNode::getFloatValue () const
 double 
 SGPropertyNode::getDoubleValue () const
 {
+  if (read_logs.load(std::memory_order_relaxed)) log_read();
 				// Shortcut for common case
   if (_attr == (READ|WRITE) && _type == props::DOUBLE)
     return get_double();
@@ -1478,6 +1534,7 @@ SGPropertyNode::getDoubleValue () const
 const char *
 SGPropertyNode::getStringValue () const
 {
+  if (read_logs.load(std::memory_order_relaxed)) log_read();
 				// Shortcut for common case
   if (_attr == (READ|WRITE) && _type == props::STRING)
     return get_string();
@@ -1359,6 +1359,29 @@ public:
    */
   bool isTied () const { return _tied; }
 
+  /**
+   * Get the number of times the value of the node has been modified. The
+   * value of a tied node can change without the node knowing about it, so
+   * the version of a tied node only counts the modifications made through
+   * the node.
+   */
+  unsigned int getVersion () const { return _version; }
+
+  typedef std::vector<const SGPropertyNode*> ReadLog;
+
+  /**
+   * Set the log to which the nodes read by the calling thread are appended.
+   * A null log stops the logging.
+   *
+   * @return the previous log of the calling thread.
+   */
+  static ReadLog* setReadLog (ReadLog* log);
+
+  /**
+   * Get the log to which the nodes read by the calling thread are appended.
+   */
+  static ReadLog* getReadLog ();
+
     /**
      * Bind this node to an external source.
      */
@@ -1791,6 +1814,12 @@ private:
   void trace_read () const;
 
 
+  /**
+   * Append the node to the read log of the calling thread.
+   */
+  void log_read () const;
+
+
   /**
    * Trace a write access.
    */
@@ -1806,6 +1835,7 @@ private:
   simgear::props::Type _type;
   bool _tied;
   int _attr;
+  unsigned int _version;
 
   // The right kind of pointer...
   union {
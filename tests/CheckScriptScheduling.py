@@ -0,0 +1,150 @@
+# CheckScriptScheduling.py
+#
+# A regression test that checks that the scheduling of the script events does
+# not modify the order nor the time at which they are fired.
+#
+# Copyright (c) 2026 Outerra
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
+
+# Each event increments test/counter so that test/order-* records the number of
+# events fired before it and test/time-* records the time at which it fired.
+# The event "reset at 7" resets the simulation while the events are processed.
+script = '''<?xml version="1.0"?>
+<runscript name="event scheduling">
+  <use aircraft="ball" initialize="reset00"/>
+  <run start="0.0" end="10" dt="0.01">
+    <property value="0">test/counter</property>
+    <property value="0">test/switch</property>
+    <property value="0">test/count-persistent</property>
+    <property value="0">test/continuous</property>
+    <property value="0">test/order-0.5</property>
+    <property value="0">test/time-0.5</property>
+    <property value="0">test/order-0.25</property>
+    <property value="0">test/time-0.25</property>
+    <property value="0">test/order-0.5-too</property>
+    <property value="0">test/time-delayed</property>
+    <property value="0">test/time-persistent</property>
+    <event name="timed at 0.5">
+      <condition>simulation/sim-time-sec ge 0.5</condition>
+      <set name="test/counter" value="1" type="FG_DELTA"/>
+      <set name="test/order-0.5"><function><property>test/counter</property></function></set>
+      <set name="test/time-0.5"><function><property>simulation/sim-time-sec</property></function></set>
+    </event>
+    <event name="reset at 7">
+      <condition>
+        simulation/sim-time-sec ge 7.0
+        test/resets eq 0
+      </condition>
+      <set name="test/resets" value="1" type="FG_DELTA"/>
+      <set name="simulation/reset" value="0"/>
+    </event>
+    <event name="timed at 0.25">
+      <condition>simulation/sim-time-sec ge 0.25</condition>
+      <set name="test/counter" value="1" type="FG_DELTA"/>
+      <set name="test/order-0.25"><function><property>test/counter</property></function></set>
+      <set name="test/time-0.25"><function><property>simulation/sim-time-sec</property></function></set>
+    </event>
+    <event name="timed at 0.5 too">
+      <condition>simulation/sim-time-sec ge 0.5</condition>
+      <set name="test/counter" value="1" type="FG_DELTA"/>
+      <set name="test/order-0.5-too"><function><property>test/counter</property></function></set>
+    </event>
+    <event name="delayed">
+      <condition>simulation/sim-time-sec ge 1.0</condition>
+      <delay>0.3</delay>
+      <set name="test/counter" value="1" type="FG_DELTA"/>
+      <set name="test/time-delayed"><function><property>simulation/sim-time-sec</property></function></set>
+    </event>
+    <event name="switch on">
+      <condition>simulation/sim-time-sec ge 3.0</condition>
+      <set name="test/switch" value="1"/>
+    </event>
+    <event name="switch off">
+      <condition>simulation/sim-time-sec ge 3.5</condition>
+      <set name="test/switch" value="0"/>
+    </event>
+    <event name="switch on again">
+      <condition>simulation/sim-time-sec ge 4.0</condition>
+      <set name="test/switch" value="1"/>
+    </event>
+    <event name="persistent" persistent="true">
+      <condition>test/switch eq 1</condition>
+      <set name="test/count-persistent" value="1" type="FG_DELTA"/>
+      <set name="test/time-persistent"><function><property>simulation/sim-time-sec</property></function></set>
+    </event>
+    <event name="continuous" continuous="true">
+      <condition>
+        simulation/sim-time-sec ge 5.0
+        simulation/sim-time-sec lt 6.0
+      </condition>
+      <set name="test/continuous"><function><property>simulation/sim-time-sec</property></function></set>
+    </event>
+  </run>
+</runscript>'''
+
+properties = ['simulation/sim-time-sec', 'test/counter', 'test/order-0.5',
+              'test/time-0.5', 'test/order-0.25', 'test/time-0.25',
+              'test/order-0.5-too', 'test/time-delayed', 'test/switch',
+              'test/count-persistent', 'test/time-persistent',
+              'test/continuous', 'test/resets']
+
+
+class CheckScriptScheduling(JSBSimTestCase):
+    def testScheduling(self):
+        with open('events.xml', 'w') as f:
+            f.write(script)
+
+        # fdm[0] schedules the events, fdm[1] evaluates the condition of every
+        # event at every frame.
+        fdm = []
+        for scheduling in (1, 0):
+            fdm.append(CreateFDM(self.sandbox))
+            fdm[-1]['test/resets'] = 0
+            self.assertTrue(fdm[-1].load_script('events.xml'))
+            fdm[-1]['simulation/script-scheduling'] = scheduling
+            fdm[-1].run_ic()
+
+        frame = 0
+        while True:
+            running = [f.run() for f in fdm]
+            self.assertEqual(running[0], running[1])
+            if not running[0]:
+                break
+
+            frame += 1
+            # Reset the simulation from outside of the script
+            if frame == 1500:
+                for f in fdm:
+                    f.reset_to_initial_conditions(0)
+
+            for prop in properties:
+                self.assertEqual(fdm[0][prop], fdm[1][prop],
+                                 msg='%s at frame %d' % (prop, frame))
+
+        # Check that every kind of event has been fired
+        self.assertEqual(fdm[0]['test/resets'], 1.0)
+        self.assertEqual(fdm[0]['test/order-0.25'], 0.0)
+        self.assertEqual(fdm[0]['test/order-0.5'], 1.0)
+        self.assertEqual(fdm[0]['test/order-0.5-too'], 2.0)
+        self.assertEqual(fdm[0]['test/counter'], 4.0)
+        self.assertEqual(fdm[0]['test/count-persistent'], 2.0)
+        self.assertAlmostEqual(fdm[0]['test/continuous'], 6.0)
+
+        del fdm
+
+RunTest(CheckScriptScheduling)
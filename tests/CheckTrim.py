@@ -74,4 +74,41 @@ class CheckTrim(JSBSimTestCase):
             self.assertAlmostEqual(fdm['velocities/v-fps'], 0.0, delta=1E-4)
             self.assertAlmostEqual(fdm['velocities/w-fps'], 0.0, delta=1E-4)
 
+    def test_simultaneous_trim(self):
+        # Check that the simultaneous solver trims the c172x in flight and that
+        # it finds the same controls than the axis by axis solver.
+        controls = []
+        for solver in (0, 1):  # tAxisByAxis, tSimultaneous
+            fdm = CreateFDM(self.sandbox)
+            fdm.load_model('c172x')
+            fdm.load_ic(self.sandbox.path_to_jsbsim_file('aircraft', 'c172x',
+                                                         'reset01'), False)
+            fdm.run_ic()
+            fdm['propulsion/set-running'] = -1
+            fdm['simulation/trim-solver'] = solver
+            # If the trim fails, it will raise an exception
+            fdm['simulation/do_simple_trim'] = 0  # Longitudinal trim
+
+            self.assertEqual(fdm['simulation/trim-completed'], 1)
+            self.assertLessEqual(fdm['simulation/trim-residual'], 1.0)
+            self.assertGreater(fdm['simulation/trim-iterations'], 0)
+            runs = fdm['simulation/trim-runs']
+            self.assertGreater(runs, 0)
+            controls.append((fdm['fcs/throttle-cmd-norm'],
+                             fdm['fcs/pitch-trim-cmd-norm'],
+                             fdm['aero/alpha-deg']))
+
+            # Trim again from the trimmed state: the run count must only cover
+            # the last trim and not add up to the count of the first one.
+            fdm['simulation/do_simple_trim'] = 0
+            self.assertEqual(fdm['simulation/trim-completed'], 1)
+            self.assertGreater(fdm['simulation/trim-runs'], 0)
+            self.assertLessEqual(fdm['simulation/trim-runs'], runs)
+            del fdm
+
+        # Both solvers stop as soon as the states are within their tolerances
+        # so the controls only agree approximately.
+        for axis, simultaneous in zip(controls[0], controls[1]):
+            self.assertAlmostEqual(axis, simultaneous, delta=1E-3)
+
 RunTest(CheckTrim)
@@ -0,0 +1,120 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestBuoyancyLOD.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks the gas cells at a reduced level of detail
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that launches the weather balloon twice, once at the full
+level of detail and once at eLODReduced where the buoyant forces only run every
+simulation/lod-rate frames. The gas cells must then be integrated over the
+whole period elapsed since their last update: after 5 minutes, the altitude
+and the gas temperature must match the full level of detail. Integrating the
+cells over a single time step leaves the gas more than 3 R too cold.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <iostream>
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGGroundCallback.h"
+#include "models/FGPropagate.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const double Duration = 300.0; // s
+static const double AltitudeTolerance = 1.0; // ft
+static const double TemperatureTolerance = 0.05; // R
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Flies the weather balloon at the given level of detail. Returns false on
+// failure.
+
+bool Fly(const SGPath& root, int lod, double& altitude, double& temperature)
+{
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath(SGPath("aircraft"));
+  fdm.SetEnginePath(SGPath("engine"));
+  fdm.SetSystemsPath(SGPath("systems"));
+
+  if (!fdm.LoadModel("weather-balloon") || !fdm.GetIC()->Load(SGPath("reset10"))) {
+    cout << "Could not load the weather balloon" << endl;
+    return false;
+  }
+  fdm.DisableOutput();
+  fdm.RunIC();
+  fdm.SetPropertyValue("simulation/lod", lod);
+  fdm.SetPropertyValue("simulation/lod-rate", 4);
+
+  while (fdm.GetSimTime() < Duration) fdm.Run();
+
+  altitude = fdm.GetPropagate()->GetAltitudeASL();
+  temperature = fdm.GetPropertyValue("buoyant_forces/gas-cell/temp-R");
+  cout << "lod " << lod << ": altitude " << altitude << " ft, gas temperature "
+       << temperature << " R" << endl;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+
+  FGJSBBase::debug_lvl = 0;
+
+  double fullAltitude, fullTemperature, altitude, temperature;
+
+  try {
+    if (!Fly(root, FGFDMExec::eLODFull, fullAltitude, fullTemperature)
+        || !Fly(root, FGFDMExec::eLODReduced, altitude, temperature))
+      return 1;
+  } catch (const string& msg) {
+    cout << msg << endl;
+    return 1;
+  }
+
+  if (fabs(altitude - fullAltitude) > AltitudeTolerance) return 1;
+  if (fabs(temperature - fullTemperature) > TemperatureTolerance) return 1;
+
+  return 0;
+}
@@ -0,0 +1,152 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestChannelSchedule.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks the stages of the parallel execution of the FCS channels
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that adds systems to the ball and checks how their channels
+are scheduled when simulation/fcs-threads is greater than 1. Two channels
+writing properties tied by different models (fcs/elevator-cmd-norm and
+atmosphere/delta-T) are independent and must share a stage. A third channel
+writing another property of the fcs branch (fcs/aileron-cmd-norm) must be
+serialized with the first one.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <fstream>
+#include <iostream>
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGGroundCallback.h"
+#include "input_output/FGXMLFileRead.h"
+#include "models/FGFCS.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const char* IndependentSystem =
+  "<system name=\"independent\">\n"
+  "  <channel name=\"pitch\">\n"
+  "    <summer name=\"pitch-cmd\">\n"
+  "      <input>velocities/vt-fps</input>\n"
+  "      <output>fcs/elevator-cmd-norm</output>\n"
+  "    </summer>\n"
+  "  </channel>\n"
+  "  <channel name=\"temperature\">\n"
+  "    <summer name=\"temperature-bias\">\n"
+  "      <input>velocities/h-dot-fps</input>\n"
+  "      <output>atmosphere/delta-T</output>\n"
+  "    </summer>\n"
+  "  </channel>\n"
+  "</system>\n";
+
+static const char* SameBranchSystem =
+  "<system name=\"same-branch\">\n"
+  "  <channel name=\"roll\">\n"
+  "    <summer name=\"roll-cmd\">\n"
+  "      <input>velocities/vt-fps</input>\n"
+  "      <output>fcs/aileron-cmd-norm</output>\n"
+  "    </summer>\n"
+  "  </channel>\n"
+  "</system>\n";
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Loads a system in the FCS of the FDM and runs one frame to schedule the
+// channels. Returns the number of stages or -1 on failure.
+
+int LoadSystem(FGFDMExec& fdm, const char* name, const char* system)
+{
+  string fileName = string(name) + ".xml";
+  {
+    ofstream file(fileName.c_str());
+    file << "<?xml version=\"1.0\"?>\n" << system;
+  }
+
+  FGXMLFileRead reader;
+  Element* document = reader.LoadXMLDocument(SGPath(fileName));
+  if (!document || !fdm.GetFCS()->Load(document)) {
+    cout << "Could not load the system " << name << endl;
+    return -1;
+  }
+  remove(fileName.c_str());
+
+  fdm.Run();
+  return fdm.GetFCS()->GetNumChannelStages();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+
+  FGJSBBase::debug_lvl = 0;
+
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath(SGPath("aircraft"));
+  fdm.SetEnginePath(SGPath("engine"));
+  fdm.SetSystemsPath(SGPath("systems"));
+
+  int errors = 0;
+
+  try {
+    if (!fdm.LoadModel("ball") || !fdm.GetIC()->Load(SGPath("reset01"))) {
+      cout << "Could not load the ball" << endl;
+      return 1;
+    }
+    fdm.DisableOutput();
+    fdm.RunIC();
+    fdm.SetPropertyValue("simulation/fcs-threads", 2);
+
+    int stages = LoadSystem(fdm, "independent", IndependentSystem);
+    cout << "independent channels: " << stages << " stage(s)" << endl;
+    if (stages != 1) errors++;
+
+    stages = LoadSystem(fdm, "same-branch", SameBranchSystem);
+    cout << "with a channel of the same branch: " << stages << " stage(s)" << endl;
+    if (stages != 2) errors++;
+  } catch (const string& msg) {
+    cout << msg << endl;
+    return 1;
+  }
+
+  return errors ? 1 : 0;
+}
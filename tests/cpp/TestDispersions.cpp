@@ -0,0 +1,160 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestDispersions.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks that the dispersions follow simulation/randomseed
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that loads the ball several times in the same thread with
+the dispersions enabled (JSBSIM_DISPERSE=1) and adds a system whose summers
+have a dispersed bias. Two loads with the same simulation/randomseed must give
+the same dispersed values, and a load with another seed different values.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGGroundCallback.h"
+#include "input_output/FGXMLFileRead.h"
+#include "models/FGFCS.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const char* FileName = "TestDispersions.xml";
+
+static const char* DispersedSystem =
+  "<?xml version=\"1.0\"?>\n"
+  "<system name=\"dispersed\">\n"
+  "  <channel name=\"biases\">\n"
+  "    <summer name=\"gaussian-bias\">\n"
+  "      <input>fcs/aileron-cmd-norm</input>\n"
+  "      <bias dispersion=\"1.0\" type=\"gaussian\">0.0</bias>\n"
+  "      <output>test/gaussian</output>\n"
+  "    </summer>\n"
+  "    <summer name=\"uniform-bias\">\n"
+  "      <input>fcs/aileron-cmd-norm</input>\n"
+  "      <bias dispersion=\"1.0\" type=\"uniform\">0.0</bias>\n"
+  "      <output>test/uniform</output>\n"
+  "    </summer>\n"
+  "  </channel>\n"
+  "</system>\n";
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Loads the ball and the dispersed system with the given seed and returns the
+// dispersed biases. Returns false on failure.
+
+bool Load(const SGPath& root, int seed, double biases[2])
+{
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath(SGPath("aircraft"));
+  fdm.SetEnginePath(SGPath("engine"));
+  fdm.SetSystemsPath(SGPath("systems"));
+  fdm.SetPropertyValue("simulation/randomseed", seed);
+
+  if (!fdm.LoadModel("ball") || !fdm.GetIC()->Load(SGPath("reset01"))) {
+    cout << "Could not load the ball" << endl;
+    return false;
+  }
+
+  FGXMLFileRead reader;
+  Element* document = reader.LoadXMLDocument(SGPath(FileName));
+  if (!document || !fdm.GetFCS()->Load(document)) {
+    cout << "Could not load " << FileName << endl;
+    return false;
+  }
+
+  fdm.DisableOutput();
+  fdm.RunIC();
+  fdm.Run();
+
+  biases[0] = fdm.GetPropertyValue("test/gaussian");
+  biases[1] = fdm.GetPropertyValue("test/uniform");
+  cout << "seed " << seed << ": biases " << biases[0] << ", " << biases[1]
+       << endl;
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+
+  FGJSBBase::debug_lvl = 0;
+
+#ifdef _MSC_VER
+  _putenv_s("JSBSIM_DISPERSE", "1");
+#else
+  setenv("JSBSIM_DISPERSE", "1", 1);
+#endif
+
+  {
+    ofstream file(FileName);
+    file << DispersedSystem;
+  }
+
+  double first[2], second[2], other[2];
+  int errors = 0;
+
+  try {
+    if (!Load(root, 7, first) || !Load(root, 7, second)
+        || !Load(root, 8, other))
+      errors++;
+  } catch (const string& msg) {
+    cout << msg << endl;
+    errors++;
+  }
+
+  if (!errors) {
+    for (int i=0; i<2; i++) {
+      if (first[i] != second[i]) errors++; // Same seed
+      if (first[i] == other[i]) errors++;  // Another seed
+      if (first[i] == 0.0) errors++;       // Not dispersed
+    }
+  }
+
+  remove(FileName);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,134 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestFCSModes.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks that the FCS execution modes give the same results
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that runs the first two minutes of the c1723 script (take off
+and climb of the c172x under the control of its autopilot) with each of the
+execution modes of the FCS and checks that the final state and the FCS outputs
+are bit for bit the same as with the default execution. The script is stopped
+before its event that saves an initialization file in the aircraft directory.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <iostream>
+#include <vector>
+
+#include "FGFDMExec.h"
+#include "input_output/FGGroundCallback.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const double Duration = 120.0; // s
+
+// Property enabling each mode, the first one being the default execution.
+static const char* Modes[] = {0, "simulation/change-driven",
+                              "simulation/fcs-compiled"};
+
+static const char* Properties[] = {
+  "position/lat-geod-rad", "position/long-gc-rad", "position/h-sl-ft",
+  "attitude/phi-rad", "attitude/theta-rad", "attitude/psi-rad",
+  "velocities/u-fps", "velocities/v-fps", "velocities/w-fps",
+  "velocities/p-rad_sec", "velocities/q-rad_sec", "velocities/r-rad_sec",
+  "fcs/elevator-pos-rad", "fcs/left-aileron-pos-rad", "fcs/rudder-pos-rad",
+  "fcs/throttle-pos-norm", "fcs/mixture-pos-norm", "ap/elevator_cmd",
+  "ap/aileron_cmd"};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Runs the script with the given mode enabled and returns the values of the
+// properties at the end. Returns false on failure.
+
+bool RunScript(const SGPath& root, const char* mode, vector<double>& values)
+{
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath(SGPath("aircraft"));
+  fdm.SetEnginePath(SGPath("engine"));
+  fdm.SetSystemsPath(SGPath("systems"));
+
+  if (!fdm.LoadScript(SGPath("scripts/c1723.xml"))) {
+    cout << "Could not load the script" << endl;
+    return false;
+  }
+  fdm.DisableOutput();
+  if (mode) fdm.SetPropertyValue(mode, 1.0);
+  fdm.RunIC();
+
+  while (fdm.GetSimTime() < Duration && fdm.Run()) {}
+
+  values.clear();
+  for (unsigned int i=0; i<sizeof(Properties)/sizeof(Properties[0]); i++)
+    values.push_back(fdm.GetPropertyValue(Properties[i]));
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+
+  FGJSBBase::debug_lvl = 0;
+
+  vector<double> reference, values;
+  int errors = 0;
+
+  try {
+    if (!RunScript(root, Modes[0], reference)) return 1;
+
+    for (unsigned int i=1; i<sizeof(Modes)/sizeof(Modes[0]); i++) {
+      if (!RunScript(root, Modes[i], values)) return 1;
+
+      for (unsigned int j=0; j<values.size(); j++) {
+        if (values[j] != reference[j]) {
+          cout << Modes[i] << ": " << Properties[j] << " = " << values[j]
+               << " instead of " << reference[j] << endl;
+          errors++;
+        }
+      }
+    }
+  } catch (const string& msg) {
+    cout << msg << endl;
+    return 1;
+  }
+
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,191 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestMSISCache.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks the cache of the MSIS atmosphere
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test of MSISCache. MSIS does not implement the pressure and the
+temperature queries of FGAtmosphere, so the test derives a minimal concrete
+class from it. A cached instance is compared against an instance which
+evaluates the model at every call:
+- the time of day of the cache is quantized to the refresh interval and the
+  latitude and local solar time spacings are rounded to divide 180 deg and
+  24 hours, and instances with the same inputs share a cache;
+- at a node of the grid, the cached values are those of the model;
+- between the nodes, the cached values are the trilinear interpolation of the
+  temperature and of the logarithm of the density at the 8 surrounding nodes,
+  including across midnight of the local solar time and at the poles, where
+  the last row of nodes must carry the whole latitude weight.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <iostream>
+
+#include "FGFDMExec.h"
+#include "input_output/FGGroundCallback.h"
+#include "models/atmosphere/FGMSIS.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const int Day = 172;
+static const double Tolerance = 1E-9; // relative
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// MSIS with the atmosphere queries it does not implement.
+
+class TestMSIS : public MSIS
+{
+public:
+  TestMSIS(FGFDMExec* fdm) : MSIS(fdm) { InitModel(); }
+
+  double GetTemperature(double altitude) const { return 0.0; }
+  void SetTemperature(double t, double h, eTemperature unit) {}
+  double GetPressure(double altitude) const { return 0.0; }
+
+  /// Temperature (K) and total mass density (g/cm3) at the given location.
+  void Evaluate(double sec, double alt, double lat, double lon, double& t,
+                double& d)
+  {
+    Calculate(Day, sec, alt, lat, lon);
+    t = output.t[1];
+    d = output.d[5];
+  }
+
+  const MSISCache* GetCache(void) const { return Cache; }
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns 1 if the values of the cached instance at the given location are not
+// the interpolation of the values of the model at the nodes of its cache.
+
+int Check(const char* name, TestMSIS& cached, TestMSIS& model, double sec,
+          double alt, double lat, double lon)
+{
+  double t, d;
+  cached.Evaluate(sec, alt, lat, lon, t, d);
+  const MSISCache::Key& key = cached.GetCache()->GetKey();
+
+  int nlat = (int)(180.0/key.latStep + 0.5);
+  int nlst = (int)(24.0/key.lstStep + 0.5);
+  double lst = sec/3600 + lon/15;
+  lst -= 24.0*floor(lst/24.0);
+  double x = alt/3281/key.altStep, y = (lat + 90.0)/key.latStep;
+  double z = lst/key.lstStep;
+  int ialt = (int)floor(x), ilat = (int)floor(y), ilst = (int)floor(z);
+  double w[3] = {x - ialt, y - ilat, z - ilst};
+  if (ilat >= nlat) { ilat = nlat-1; w[1] = 1.0; }
+  if (ilst >= nlst) { ilst = nlst-1; w[2] = 1.0; }
+
+  double expectedT = 0.0, expectedLogD = 0.0;
+  for (int i=0; i<8; i++) {
+    double weight = 1.0;
+    for (int j=0; j<3; j++) weight *= (i >> j) & 1 ? w[j] : 1.0 - w[j];
+    double nodeLat = -90.0 + (ilat + ((i >> 1) & 1))*key.latStep;
+    double nodeLst = ((ilst + ((i >> 2) & 1)) % nlst)*key.lstStep;
+    double nodeLon = 15.0*(nodeLst - key.sec/3600);
+    nodeLon -= 360.0*floor((nodeLon + 180.0)/360.0);
+    double nodeT, nodeD;
+    model.Evaluate(key.sec, (ialt + (i & 1))*key.altStep*3281, nodeLat, nodeLon,
+                   nodeT, nodeD);
+    expectedT += weight*nodeT;
+    expectedLogD += weight*log(nodeD);
+  }
+  double expectedD = exp(expectedLogD);
+
+  cout << name << ": T " << t << " K, rho " << d << " g/cm3, expected "
+       << expectedT << " K, " << expectedD << " g/cm3" << endl;
+
+  if (fabs(t - expectedT) > Tolerance*expectedT) return 1;
+  if (fabs(d - expectedD) > Tolerance*expectedD) return 1;
+  return 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  FGJSBBase::debug_lvl = 0;
+
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  TestMSIS cached(&fdm), other(&fdm), model(&fdm);
+  model.SetCache(0.0);
+
+  int errors = 0;
+  double t, d;
+
+  // Quantization of the key and sharing of the cache
+  cached.SetCache(300.0, 1.0, 7.0, 0.7);
+  other.SetCache(300.0, 1.0, 7.0, 0.7);
+  cached.Evaluate(1000.0, 100000.0, 41.3, -71.2, t, d);
+  const MSISCache::Key& key = cached.GetCache()->GetKey();
+  cout << "key: " << key.sec << " s, " << key.latStep << " deg, "
+       << key.lstStep << " h" << endl;
+  if (key.sec != 900.0 || key.latStep != 180.0/26 || key.lstStep != 24.0/34)
+    errors++;
+  other.Evaluate(1199.9, 100000.0, 41.3, -71.2, t, d);
+  if (other.GetCache() != cached.GetCache()) {
+    cout << "The instances do not share their cache" << endl;
+    errors++;
+  }
+  other.Evaluate(1200.0, 100000.0, 41.3, -71.2, t, d);
+  if (other.GetCache()->GetKey().sec != 1200.0) {
+    cout << "The cache is not refreshed at 1200 s" << endl;
+    errors++;
+  }
+
+  // Node of the grid: 100 km, 40 deg, 6 hours
+  cached.SetCache(300.0);
+  double model_t, model_d;
+  model.Evaluate(900.0, 100.0*3281, 40.0, 15.0*(6.0 - 0.25), model_t, model_d);
+  cached.Evaluate(900.0, 100.0*3281, 40.0, 15.0*(6.0 - 0.25), t, d);
+  cout << "node: T " << t << " K, rho " << d << " g/cm3, model " << model_t
+       << " K, " << model_d << " g/cm3" << endl;
+  if (fabs(t - model_t) > Tolerance*model_t) errors++;
+  if (fabs(d - model_d) > Tolerance*model_d) errors++;
+
+  // Interpolation between the nodes
+  errors += Check("interior", cached, model, 1000.0, 100.3*3281, 41.3, -71.2);
+  errors += Check("midnight", cached, model, 1000.0, 85.6*3281, -12.1,
+                  15.0*(23.8 - 1000.0/3600));
+  errors += Check("north pole", cached, model, 1000.0, 120.7*3281, 90.0, 33.0);
+  errors += Check("south pole", cached, model, 1000.0, 120.7*3281, -90.0, 33.0);
+  errors += Check("near the pole", cached, model, 1000.0, 120.7*3281, 89.1, 33.0);
+
+  return errors ? 1 : 0;
+}
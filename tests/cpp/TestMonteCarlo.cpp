@@ -0,0 +1,164 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestMonteCarlo.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks the reproducibility of Monte Carlo campaigns
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that runs a small Monte Carlo campaign of the ball script with
+1 and 4 threads and checks that both result files are identical byte for byte.
+The campaign disperses the initial altitude and velocity, and its failures
+switch the turbulence on at a random time, so the results also depend on the
+random seed of each case. A campaign with another seed must give different
+results.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include "FGFDMExec.h"
+#include "FGMonteCarlo.h"
+#include "input_output/FGGroundCallback.h"
+#include "input_output/FGXMLFileRead.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const char* CampaignFile = "TestMonteCarlo.xml";
+
+static const char* Campaign =
+  "<?xml version=\"1.0\"?>\n"
+  "<campaign name=\"ball\" script=\"scripts/ball.xml\" cases=\"12\" end_time=\"5\">\n"
+  "  <dispersion property=\"ic/h-sl-ft\" type=\"gaussian\" value=\"1000\"/>\n"
+  "  <dispersion property=\"ic/u-fps\" type=\"uniform\" value=\"50\"/>\n"
+  "  <failure property=\"atmosphere/turbulence/milspec/severity\" value=\"6\"\n"
+  "           probability=\"1\"/>\n"
+  "  <failure property=\"atmosphere/turb-type\" value=\"4\" probability=\"0.7\"\n"
+  "           start=\"1\" end=\"3\"/>\n"
+  "  <metric property=\"position/h-sl-ft\"/>\n"
+  "  <metric property=\"velocities/vt-fps\" type=\"max\"/>\n"
+  "  <metric property=\"velocities/vt-fps\" type=\"mean\"/>\n"
+  "</campaign>\n";
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Runs the campaign with the given seed and number of threads and returns the
+// content of its result file, or an empty string on failure.
+
+string RunCampaign(FGFDMExec& fdm, Element* document, unsigned int seed,
+                   unsigned int nThreads)
+{
+  string fileName = "TestMonteCarlo.bin";
+  FGMonteCarlo campaign(&fdm);
+  if (!campaign.Load(document)) {
+    cout << "Could not load the campaign" << endl;
+    return string();
+  }
+  campaign.SetSeed(seed);
+
+  if (!campaign.Run(SGPath(fileName), nThreads)) {
+    cout << campaign.GetNumFailed() << " case(s) failed with seed " << seed
+         << " and " << nThreads << " thread(s)" << endl;
+    return string();
+  }
+
+  string results;
+  {
+    ifstream file(fileName.c_str(), ios::binary);
+    results.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+  }
+  remove(fileName.c_str());
+
+  cout << "seed " << seed << ", " << nThreads << " thread(s): "
+       << results.size() << " bytes" << endl;
+  return results;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+
+  FGJSBBase::debug_lvl = 0;
+
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath(SGPath("aircraft"));
+  fdm.SetEnginePath(SGPath("engine"));
+  fdm.SetSystemsPath(SGPath("systems"));
+
+  {
+    ofstream file(CampaignFile);
+    file << Campaign;
+  }
+
+  int errors = 0;
+
+  try {
+    FGXMLFileRead reader;
+    Element* document = reader.LoadXMLDocument(SGPath(CampaignFile));
+    remove(CampaignFile);
+    if (!document) {
+      cout << "Could not read the campaign" << endl;
+      return 1;
+    }
+
+    string serial = RunCampaign(fdm, document, 3, 1);
+    string parallel = RunCampaign(fdm, document, 3, 4);
+    string other = RunCampaign(fdm, document, 4, 4);
+    if (serial.empty() || parallel.empty() || other.empty()) return 1;
+
+    if (parallel != serial) {
+      cout << "The results depend on the number of threads" << endl;
+      errors++;
+    }
+    if (other == serial) {
+      cout << "The results do not depend on the seed" << endl;
+      errors++;
+    }
+  } catch (const string& msg) {
+    cout << msg << endl;
+    return 1;
+  }
+
+  return errors ? 1 : 0;
+}
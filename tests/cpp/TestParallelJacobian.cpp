@@ -0,0 +1,198 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestParallelJacobian.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Compares the serial and parallel Jacobians of FGStateSpace
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that evaluates the Jacobians [A B] and [C D] of the state
+space of the ball serially and on a thread pool of cloned FDMs, and checks
+that both agree. The ball has no engine and no FCS, so each evaluation only
+depends on the perturbed state and not on the evaluations made before it: the
+order of the evaluations, which differs between the two paths, does not
+matter. The altitude is left out of the state: its finite differences are
+dominated by the round-off of the geodetic conversion.
+
+The Jacobians are then evaluated again with an output component defined by the
+application which does not implement clone(): the parallel path must fall back
+to the serial one and give the same result.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "FGFDMExec.h"
+#include "FGThreadPool.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGGroundCallback.h"
+#include "math/FGStateSpace.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+typedef vector< vector<double> > Matrix;
+
+static const unsigned int NumThreads = 3;
+static const double Tolerance = 1E-3;  // relative to the largest term of the matrix
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Output component of an application, which cannot be cloned.
+
+class Mach : public FGStateSpace::Component
+{
+public:
+  Mach() : Component("Mach", "") {}
+  double get() const { return m_fdm->GetAuxiliary()->GetMach(); }
+  void set(double) {}
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the number of terms of the two matrices that differ.
+
+int Compare(const char* name, const Matrix& serial, const Matrix& parallel)
+{
+  double scale = 0.0;
+  for (unsigned int i=0; i<serial.size(); i++)
+    for (unsigned int j=0; j<serial[i].size(); j++)
+      scale = max(scale, fabs(serial[i][j]));
+  if (scale == 0.0) scale = 1.0;
+
+  int errors = 0;
+  double worst = 0.0;
+
+  if (serial.size() != parallel.size()) {
+    cout << name << ": the sizes differ" << endl;
+    return 1;
+  }
+
+  for (unsigned int i=0; i<serial.size(); i++) {
+    if (serial[i].size() != parallel[i].size()) {
+      cout << name << ": the sizes differ" << endl;
+      return 1;
+    }
+    for (unsigned int j=0; j<serial[i].size(); j++) {
+      double error = fabs(serial[i][j] - parallel[i][j]) / scale;
+      worst = max(worst, error);
+      if (!(error <= Tolerance)) {
+        cout << name << "[" << i << "][" << j << "]: serial " << serial[i][j]
+             << " parallel " << parallel[i][j] << endl;
+        errors++;
+      }
+    }
+  }
+
+  cout << name << ": largest relative difference " << worst << endl;
+  return errors;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+
+  FGJSBBase::debug_lvl = 0;
+
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath(SGPath("aircraft"));
+  fdm.SetEnginePath(SGPath("engine"));
+  fdm.SetSystemsPath(SGPath("systems"));
+
+  try {
+    if (!fdm.LoadModel("ball") || !fdm.GetIC()->Load(SGPath("reset01"))) {
+      cout << "Could not load the ball" << endl;
+      return 1;
+    }
+    fdm.DisableOutput();
+    fdm.RunIC();
+  } catch (const string& msg) {
+    cout << msg << endl;
+    return 1;
+  }
+
+  FGStateSpace ss(&fdm);
+  ss.x.add(new FGStateSpace::Vt);
+  ss.x.add(new FGStateSpace::Alpha);
+  ss.x.add(new FGStateSpace::Theta);
+  ss.x.add(new FGStateSpace::Q);
+  ss.x.add(new FGStateSpace::Beta);
+  ss.x.add(new FGStateSpace::Phi);
+  ss.x.add(new FGStateSpace::P);
+  ss.x.add(new FGStateSpace::R);
+  ss.x.add(new FGStateSpace::Psi);
+  ss.y = ss.x;
+
+  vector<double> x0 = ss.x.get(), u0 = ss.u.get(), y0 = x0;
+  Matrix A, B, C, D, Ap, Bp, Cp, Dp;
+
+  vector<FGFDMExec*> clones;
+  for (unsigned int i=0; i<NumThreads; i++) {
+    FGFDMExec* clone = fdm.Clone();
+    if (!clone) {
+      cout << "Could not clone the ball" << endl;
+      return 1;
+    }
+    clones.push_back(clone);
+  }
+
+  int errors = 0;
+  FGThreadPool pool(NumThreads);
+
+  for (int pass=0; pass<2; pass++) {
+    if (pass == 1) {
+      ss.y.add(new Mach);
+      y0 = ss.y.get();
+    }
+
+    ss.linearize(x0, u0, y0, Ap, Bp, Cp, Dp, pool, clones);
+
+    ss.x.set(x0);
+    ss.u.set(u0);
+    ss.linearize(x0, u0, y0, A, B, C, D);
+
+    errors += Compare("A", A, Ap) + Compare("B", B, Bp) + Compare("C", C, Cp)
+            + Compare("D", D, Dp);
+  }
+
+  for (unsigned int i=0; i<clones.size(); i++) delete clones[i];
+
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,114 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestPressureProfile.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks the tabulated pressure of the standard atmosphere
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test of the pressure profile of FGStandardAtmosphere against the
+layer equations. For several combinations of temperature bias, temperature
+gradient and sea level pressure, the pressure is sampled from sea level to
+300000 ft right after the modification, while the profile is stale and the
+pressure is given by the layer equations. The atmosphere is then run until the
+profile is regenerated and the pressure is sampled again at the same
+altitudes: both samples must agree to 1E-12 (relative).
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "FGFDMExec.h"
+#include "input_output/FGGroundCallback.h"
+#include "models/atmosphere/FGStandardAtmosphere.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const double Tolerance = 1E-12; // relative
+static const double AltitudeStep = 3.7; // ft, not a divisor of the profile spacing
+static const double TopAltitude = 300000.0; // ft
+static const int RegenerationRuns = 2000; // more than the number of intervals
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  FGJSBBase::debug_lvl = 0;
+
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  FGStandardAtmosphere* atmosphere = static_cast<FGStandardAtmosphere*>(fdm.GetAtmosphere());
+
+  const double bias[] = {0.0, 30.0, -40.0}; // R
+  const double gradient[] = {0.0, 20.0, -25.0}; // R
+  const double pressure[] = {2116.22, 2000.0, 2200.0}; // psf
+  double worst = 0.0;
+  int errors = 0;
+
+  for (int i=0; i<3; i++) {
+    for (int j=0; j<3; j++) {
+      for (int k=0; k<3; k++) {
+        atmosphere->SetTemperatureBias(FGAtmosphere::eRankine, bias[i]);
+        atmosphere->SetSLTemperatureGradedDelta(FGAtmosphere::eRankine, gradient[j]);
+        atmosphere->SetPressureSL(FGAtmosphere::ePSF, pressure[k]);
+
+        vector<double> exact;
+        for (double h=0.0; h<TopAltitude; h+=AltitudeStep)
+          exact.push_back(atmosphere->GetPressure(h));
+
+        for (int n=0; n<RegenerationRuns; n++) atmosphere->Run(false);
+
+        unsigned int n = 0;
+        for (double h=0.0; h<TopAltitude; h+=AltitudeStep, n++) {
+          double error = fabs(atmosphere->GetPressure(h) - exact[n]) / exact[n];
+          worst = max(worst, error);
+          if (!(error <= Tolerance)) {
+            cout << "bias " << bias[i] << " R, gradient " << gradient[j]
+                 << " R, sea level pressure " << pressure[k] << " psf: P("
+                 << h << " ft) = " << atmosphere->GetPressure(h)
+                 << " instead of " << exact[n] << endl;
+            errors++;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  cout << "largest relative error " << worst << endl;
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,167 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestRunAllocations.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks that FGFDMExec::Run() does not allocate once warmed up
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that installs a counting operator new and checks that, once
+an aircraft has been run for a few seconds, FGFDMExec::Run() makes no heap
+allocation. The aircraft are chosen to exercise all the standard models: piston,
+turbine, rocket and electric engines, rotors, buoyant forces, ground reactions
+with friction and flight control systems. The output is disabled: the text
+tables of the output still build strings at the output rate.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include <iostream>
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGGroundCallback.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+COUNTING ALLOCATOR
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// The operators are not inlined: GCC would otherwise see the memory returned
+// by operator new released by free() and warn about mismatched functions.
+#if defined(_MSC_VER)
+#  define NOINLINE __declspec(noinline)
+#else
+#  define NOINLINE __attribute__((noinline))
+#endif
+
+static atomic<unsigned long> AllocationCount(0);
+
+static void* Allocate(size_t size)
+{
+  AllocationCount++;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw bad_alloc();
+  return p;
+}
+
+NOINLINE void* operator new(size_t size) { return Allocate(size); }
+NOINLINE void* operator new[](size_t size) { return Allocate(size); }
+NOINLINE void operator delete(void* p) noexcept { free(p); }
+NOINLINE void operator delete[](void* p) noexcept { free(p); }
+NOINLINE void operator delete(void* p, size_t) noexcept { free(p); }
+NOINLINE void operator delete[](void* p, size_t) noexcept { free(p); }
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+struct Case {
+  const char* aircraft;
+  const char* ic;
+};
+
+static const Case Cases[] = {
+  {"c172x", "reset01"},            // piston, autopilot, in flight
+  {"c172x", "reset_at_rest"},      // ground reactions and friction
+  {"737", "cruise_init"},          // turbines
+  {"f16", "reset00"},              // turbine with augmentation, FCS
+  {"ah1s", "reset00"},             // rotors
+  {"ZLT-NT", "reset00"},           // buoyant forces, gas cells
+  {"Submarine_Scout", "reset01"},  // ballonets
+  {"X15", "reset01"},              // rocket
+  {"ball", "reset01"},             // no engine, no ground contact
+  {"p51d", "reset01"},             // piston with many systems
+};
+
+static const double WarmupTime = 5.0;  // [s]
+static const int MeasuredFrames = 1000;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the number of allocations per frame, or a negative value if the case
+// could not be run.
+
+double RunCase(const SGPath& root, const Case& c)
+{
+  FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+  fdm.SetRootDir(root);
+  fdm.SetAircraftPath(SGPath("aircraft"));
+  fdm.SetEnginePath(SGPath("engine"));
+  fdm.SetSystemsPath(SGPath("systems"));
+
+  if (!fdm.LoadModel(c.aircraft)) return -1.0;
+  if (!fdm.GetIC()->Load(SGPath(c.ic))) return -1.0;
+  fdm.DisableOutput();
+  if (!fdm.RunIC()) return -1.0;
+
+  while (fdm.GetSimTime() < WarmupTime) fdm.Run();
+
+  unsigned long start = AllocationCount;
+  for (int i=0; i<MeasuredFrames; i++) fdm.Run();
+
+  return double(AllocationCount - start) / MeasuredFrames;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+  int failures = 0;
+
+  FGJSBBase::debug_lvl = 0;
+
+  for (unsigned int i=0; i<sizeof(Cases)/sizeof(Cases[0]); i++) {
+    double allocations;
+    try {
+      allocations = RunCase(root, Cases[i]);
+    } catch (const string& msg) {
+      cerr << Cases[i].aircraft << ": " << msg << endl;
+      allocations = -1.0;
+    }
+
+    cout << Cases[i].aircraft << " (" << Cases[i].ic << "): ";
+    if (allocations < 0.0)
+      cout << "FAILED to run" << endl;
+    else
+      cout << allocations << " allocations per frame" << endl;
+
+    if (allocations != 0.0) failures++;
+  }
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,135 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestTurbulenceBank.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks the statistics of the precomputed Dryden turbulence
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test of the sequences of FGTurbulenceBank. Over a whole period,
+each sequence must have a zero mean, a unit variance and the autocorrelation of
+its Dryden spectrum: exp(-s) for the first order filter and (1 - s/2) exp(-s)
+for the second order filter, s being the lag in scale lengths. The sequences
+are read periodically, so the step between the last and the first sample must
+not be larger than the steps within the sequence.
+
+The statistics are estimated over a finite period (5243 scale lengths), with a
+standard deviation of about 0.02: the tolerance is 0.08.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "models/atmosphere/FGTurbulenceBank.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const double Tolerance = 0.08;
+static const double Lags[] = {0.5, 1.0, 2.0, 3.0}; // scale lengths
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Autocorrelation of the Dryden spectra.
+
+double Autocorrelation(FGTurbulenceBank::eFilter filter, double s)
+{
+  if (filter == FGTurbulenceBank::eFirstOrder)
+    return exp(-s);
+  else
+    return (1.0 - 0.5*s)*exp(-s);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the number of statistics of the sequence that are out of tolerance.
+
+int Check(const char* name, const FGTurbulenceBank* bank,
+          FGTurbulenceBank::eFilter filter)
+{
+  unsigned int n = (unsigned int)(FGTurbulenceBank::Length/FGTurbulenceBank::Spacing + 0.5);
+  vector<double> y(n);
+  for (unsigned int k=0; k<n; k++)
+    y[k] = bank->GetValue(filter, (k + 0.5)*FGTurbulenceBank::Spacing);
+
+  double mean = 0.0;
+  for (unsigned int k=0; k<n; k++) mean += y[k];
+  mean /= n;
+
+  double variance = 0.0, step = 0.0;
+  for (unsigned int k=0; k<n; k++) {
+    variance += (y[k] - mean)*(y[k] - mean);
+    if (k+1 < n) step = max(step, fabs(y[k+1] - y[k]));
+  }
+  variance /= n;
+  double wrap = fabs(y[0] - y[n-1]);
+
+  int errors = 0;
+  cout << name << ": mean " << mean << ", variance " << variance
+       << ", step at the end of the period " << wrap << " (largest step "
+       << step << ")" << endl;
+  if (fabs(mean) > Tolerance) errors++;
+  if (fabs(variance - 1.0) > Tolerance) errors++;
+  if (wrap > step) errors++;
+
+  for (unsigned int i=0; i<sizeof(Lags)/sizeof(Lags[0]); i++) {
+    unsigned int lag = (unsigned int)(Lags[i]/FGTurbulenceBank::Spacing + 0.5);
+    double r = 0.0;
+    for (unsigned int k=0; k<n; k++)
+      r += (y[k] - mean)*(y[(k + lag) % n] - mean);
+    r /= n*variance;
+
+    double expected = Autocorrelation(filter, Lags[i]);
+    cout << "  autocorrelation at " << Lags[i] << ": " << r << " expected "
+         << expected << endl;
+    if (fabs(r - expected) > Tolerance) errors++;
+  }
+
+  return errors;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  FGTurbulenceBank* bank = FGTurbulenceBank::Acquire();
+
+  int errors = 0;
+  errors += Check("first order", bank, FGTurbulenceBank::eFirstOrder);
+  errors += Check("second order", bank, FGTurbulenceBank::eSecondOrder);
+
+  FGTurbulenceBank::Release(bank);
+  return errors ? 1 : 0;
+}
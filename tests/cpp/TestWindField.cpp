@@ -0,0 +1,188 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       TestWindField.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Checks the interpolation of a gridded wind field
+ Called by:    CTest
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+A regression test that writes a small wind field (2 nodes along the latitude,
+longitude and altitude axes, one along the time axis) around the ball and
+loads it with FGWinds::LoadWindField(). The wind components are linear in the
+node indices, so the interpolated wind is known exactly at any location. The
+wind is checked at the initial location, after a few frames and in a clone of
+the FDM, which must share the field of its source.
+
+The test is run with the JSBSim root directory as its argument.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGGroundCallback.h"
+#include "models/FGPropagate.h"
+#include "models/atmosphere/FGWinds.h"
+
+using namespace std;
+using namespace JSBSim;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+TEST
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+static const char* FileName = "TestWindField.bin";
+static const double Origin[4] = {-0.6, 89.3, 9000.0, 0.0}; // deg, deg, ft, s
+static const double Step[4] = {1.5, 1.5, 2500.0, 0.0};
+static const double Tolerance = 1E-4; // ft/s
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Wind at fractional node indices: linear, hence exactly interpolated.
+
+void Wind(const double u[3], double wind[3])
+{
+  wind[0] = 10.0 + 2.0*u[0] + 3.0*u[1] + 4.0*u[2];
+  wind[1] = -5.0 + 1.0*u[0] - 2.0*u[1] + 0.5*u[2];
+  wind[2] = 0.25*u[0] - 0.5*u[2];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool WriteField(void)
+{
+  char header[112];
+  unsigned int counts[9] = {1, 2, 2, 2, 1, 2, 2, 2, 1}; // version, nodes, tile nodes
+  memset(header, 0, sizeof(header));
+  memcpy(header, "JSBSIMWF", 8);
+  memcpy(header + 8, counts, sizeof(counts));
+  memcpy(header + 48, Origin, sizeof(Origin));
+  memcpy(header + 80, Step, sizeof(Step));
+
+  ofstream file(FileName, ios::binary);
+  file.write(header, sizeof(header));
+
+  // Single tile: the latitude varies fastest, then the longitude and altitude
+  for (int k=0; k<2; k++) {
+    for (int j=0; j<2; j++) {
+      for (int i=0; i<2; i++) {
+        double u[3] = {double(i), double(j), double(k)}, wind[3];
+        Wind(u, wind);
+        float node[3] = {(float)wind[0], (float)wind[1], (float)wind[2]};
+        file.write((const char*)node, sizeof(node));
+      }
+    }
+  }
+
+  return file.good();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns 1 if the wind field sampled by fdm differs from the expected wind.
+
+int Check(const char* name, FGFDMExec* fdm)
+{
+  FGPropagate* propagate = fdm->GetPropagate();
+  double x[3] = {propagate->GetGeodLatitudeDeg(), propagate->GetLongitudeDeg(),
+                 propagate->GetAltitudeASL()};
+  double u[3], expected[3];
+  for (int i=0; i<3; i++) u[i] = (x[i] - Origin[i]) / Step[i];
+  Wind(u, expected);
+
+  const FGColumnVector3& wind = fdm->GetWinds()->GetWindFieldNED();
+  double error = 0.0;
+  for (int i=0; i<3; i++) error = max(error, fabs(wind(i+1) - expected[i]));
+
+  cout << name << ": wind " << wind(1) << ", " << wind(2) << ", " << wind(3)
+       << " expected " << expected[0] << ", " << expected[1] << ", "
+       << expected[2] << endl;
+
+  return error <= Tolerance ? 0 : 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+int main(int argc, char* argv[])
+{
+  SGPath root(argc > 1 ? argv[1] : ".");
+
+  FGJSBBase::debug_lvl = 0;
+
+  if (!WriteField()) {
+    cout << "Could not write " << FileName << endl;
+    return 1;
+  }
+
+  int errors = 0;
+
+  {
+    FGFDMExec fdm(new FGDefaultGroundCallback(20925646.32546));
+    fdm.SetRootDir(root);
+    fdm.SetAircraftPath(SGPath("aircraft"));
+    fdm.SetEnginePath(SGPath("engine"));
+    fdm.SetSystemsPath(SGPath("systems"));
+
+    try {
+      if (!fdm.LoadModel("ball") || !fdm.GetIC()->Load(SGPath("reset01"))) {
+        cout << "Could not load the ball" << endl;
+        return 1;
+      }
+      if (!fdm.GetWinds()->LoadWindField(SGPath(FileName))) {
+        cout << "Could not load " << FileName << endl;
+        return 1;
+      }
+      fdm.DisableOutput();
+      fdm.RunIC();
+      errors += Check("initial", &fdm);
+
+      for (int i=0; i<120; i++) fdm.Run();
+      errors += Check("after 1 s", &fdm);
+
+      FGFDMExec* clone = fdm.Clone();
+      if (!clone) {
+        cout << "Could not clone the ball" << endl;
+        return 1;
+      }
+      errors += Check("clone", clone);
+      delete clone;
+    } catch (const string& msg) {
+      cout << msg << endl;
+      return 1;
+    }
+  }
+
+  remove(FileName);
+  return errors ? 1 : 0;
+}
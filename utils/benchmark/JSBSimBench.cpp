@@ -0,0 +1,795 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       JSBSimBench.cpp
+ Author:       Outerra
+ Date started: 10/18/26
+ Purpose:      Performance benchmark of the shipped aircraft and scripts
+ Called by:    The USER.
+
+ ------------- Copyright (C) 2026  Outerra -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free Software
+ Foundation; either version 2 of the License, or (at your option) any later
+ version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along with
+ this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be found on
+ the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+
+Runs every aircraft of aircraft/ (with the first initialization file found in
+its directory) and every script of scripts/ and measures for each of them:
+
+- the time to load the aircraft or the script (load-ms),
+- the time of RunIC() (run-ic-ms),
+- the number of frames per second of FGFDMExec::Run() once the simulation has
+  been warmed up (fps), and the ratio of the simulated time to the wall clock
+  time (realtime-factor),
+- the number of heap allocations made while loading (load-allocations) and
+  per frame in the steady state (allocations-per-frame),
+- the peak of the memory allocated with operator new (peak-heap-kb).
+
+The results are written to a JSON file. When a baseline file produced by a
+previous run is given, each case is compared to the baseline and the program
+returns 1 if any of them regressed by more than the tolerance:
+
+  JSBSimBench --root=<jsbsim dir> --output=baseline.json
+  ... modify the code ...
+  JSBSimBench --root=<jsbsim dir> --output=new.json --baseline=baseline.json
+
+The allocations are counted by replacing the global operator new and delete of
+the executable, so the memory allocated with malloc() (e.g. by expat) is not
+included.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/18/26   OT    Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <cctype>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#  include <psapi.h>
+#else
+#  include <dirent.h>
+#  include <sys/stat.h>
+#  include <sys/resource.h>
+#endif
+
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+#include "input_output/FGGroundCallback.h"
+#include "input_output/FGXMLFileRead.h"
+
+using namespace std;
+using JSBSim::FGFDMExec;
+using JSBSim::FGJSBBase;
+using JSBSim::FGXMLFileRead;
+using JSBSim::Element;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+COUNTING ALLOCATOR
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Each block is preceded by a header holding its size so that the memory in
+// use can be tracked. The header keeps the alignment of malloc().
+static const size_t HeaderSize = 16;
+
+static atomic<unsigned long long> AllocationCount(0);
+static atomic<long long> HeapInUse(0);
+static atomic<long long> HeapPeak(0);
+
+void* operator new(size_t size)
+{
+  char* p = (char*)malloc(size + HeaderSize);
+  if (!p) throw bad_alloc();
+  *(size_t*)p = size;
+
+  AllocationCount++;
+  long long inuse = (HeapInUse += (long long)size);
+  long long peak = HeapPeak.load();
+  while (inuse > peak && !HeapPeak.compare_exchange_weak(peak, inuse));
+
+  return p + HeaderSize;
+}
+
+void operator delete(void* ptr) noexcept
+{
+  if (!ptr) return;
+  char* p = (char*)ptr - HeaderSize;
+  HeapInUse -= (long long)*(size_t*)p;
+  free(p);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { operator delete(ptr); }
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+GLOBAL DATA
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+typedef chrono::steady_clock Clock;
+
+SGPath RootDir(".");
+string OutputName("benchmark.json");
+string BaselineName;
+string Filter;
+string Version;
+double MeasureTime = 1.0;    // wall clock time of the steady state [s]
+double WarmupTime = 1.0;     // simulated time before the steady state [s]
+double Tolerance = 10.0;     // [%]
+bool RunAircraft = true;
+bool RunScripts = true;
+bool Verbose = false;
+
+// The console output of JSBSim is discarded unless --verbose is given; the
+// progress of the benchmark is written to the original stream.
+ostream progress(cout.rdbuf());
+
+class NullBuffer : public streambuf
+{
+protected:
+  int overflow(int c) { return c == EOF ? 0 : c; }
+};
+
+struct Result {
+  string name;
+  string status;
+  double load_ms;
+  double run_ic_ms;
+  unsigned long long frames;
+  double fps;
+  double realtime_factor;
+  unsigned long long load_allocations;
+  double allocations_per_frame;
+  double peak_heap_kb;
+
+  Result(const string& n)
+    : name(n), status("ok"), load_ms(0.0), run_ic_ms(0.0), frames(0), fps(0.0),
+      realtime_factor(0.0), load_allocations(0), allocations_per_frame(0.0),
+      peak_heap_kb(0.0) {}
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FILE SYSTEM
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Returns the sorted names of the entries of a directory.
+vector<string> ListDirectory(const SGPath& dir, bool directories)
+{
+  vector<string> names;
+
+#if defined(_WIN32)
+  WIN32_FIND_DATAA data;
+  HANDLE h = FindFirstFileA((dir.utf8Str() + "\\*").c_str(), &data);
+  if (h != INVALID_HANDLE_VALUE) {
+    do {
+      bool isdir = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+      if (isdir == directories && data.cFileName[0] != '.')
+        names.push_back(data.cFileName);
+    } while (FindNextFileA(h, &data));
+    FindClose(h);
+  }
+#else
+  DIR* d = opendir(dir.utf8Str().c_str());
+  if (d) {
+    struct dirent* entry;
+    while ((entry = readdir(d)) != 0) {
+      if (entry->d_name[0] == '.') continue;
+      struct stat st;
+      string path = (dir/entry->d_name).utf8Str();
+      if (stat(path.c_str(), &st) != 0) continue;
+      if (S_ISDIR(st.st_mode) == directories) names.push_back(entry->d_name);
+    }
+    closedir(d);
+  }
+#endif
+
+  sort(names.begin(), names.end());
+  return names;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Checks that an XML file exists and that its root element is 'root'.
+
+bool CheckXMLFile(const SGPath& file, const string& root)
+{
+  if (!file.exists()) return false;
+
+  FGXMLFileRead reader;
+  Element* document = reader.LoadXMLDocument(file, false);
+  return document && document->GetName() == root;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double GetMaxRSSKb(void)
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return counters.PeakWorkingSetSize / 1024.0;
+  return 0.0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#  if defined(__APPLE__)
+  return usage.ru_maxrss / 1024.0;  // bytes on macOS
+#  else
+  return usage.ru_maxrss;
+#  endif
+#endif
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+BENCHMARK
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+double Elapsed(Clock::time_point start)
+{
+  return chrono::duration<double>(Clock::now() - start).count();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGFDMExec* CreateFDM(void)
+{
+  FGFDMExec* fdm = new FGFDMExec(new JSBSim::FGDefaultGroundCallback(20925646.32546));
+  fdm->SetRootDir(RootDir);
+  fdm->SetAircraftPath(SGPath("aircraft"));
+  fdm->SetEnginePath(SGPath("engine"));
+  fdm->SetSystemsPath(SGPath("systems"));
+  return fdm;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Runs the simulation once loaded: RunIC(), the warm-up and the steady state.
+
+void RunCase(FGFDMExec* fdm, Result& result)
+{
+  Clock::time_point start = Clock::now();
+  if (!fdm->RunIC()) {
+    result.status = "RunIC failed";
+    return;
+  }
+  result.run_ic_ms = Elapsed(start) * 1000.0;
+
+  bool running = true;
+  double warmup_end = fdm->GetSimTime() + WarmupTime;
+  while (running && fdm->GetSimTime() < warmup_end) running = fdm->Run();
+  if (!running) return;
+
+  // The steady state is measured over NumBlocks blocks of equal duration and
+  // the median of their frame rates is retained, which filters out the
+  // interruptions by the OS. The clock is only read every 64 frames to keep
+  // it out of the measure.
+  const int NumBlocks = 5;
+  vector<double> block_fps;
+  unsigned long long allocations = AllocationCount;
+  double sim_start = fdm->GetSimTime();
+  unsigned long long frames = 0;
+  double elapsed = 0.0;
+  start = Clock::now();
+
+  while (running && (int)block_fps.size() < NumBlocks) {
+    Clock::time_point block_start = Clock::now();
+    unsigned long long block_frames = 0;
+    double block_elapsed = 0.0;
+    while (running) {
+      running = fdm->Run();
+      block_frames++;
+      if ((block_frames & 63) == 0) {
+        block_elapsed = Elapsed(block_start);
+        if (block_elapsed >= MeasureTime / NumBlocks) break;
+      }
+    }
+    block_elapsed = Elapsed(block_start);
+    if (running || block_fps.empty())
+      block_fps.push_back(block_frames / block_elapsed);
+    frames += block_frames;
+  }
+  elapsed = Elapsed(start);
+
+  sort(block_fps.begin(), block_fps.end());
+  result.frames = frames;
+  result.fps = block_fps[block_fps.size() / 2];
+  result.realtime_factor = (fdm->GetSimTime() - sim_start) / elapsed;
+  result.allocations_per_frame = double(AllocationCount - allocations) / frames;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Loads an aircraft or a script with 'load' then runs it.
+
+template <class Loader>
+Result Benchmark(const string& name, Loader load)
+{
+  Result result(name);
+  progress << setw(40) << left << name << flush;
+
+  HeapPeak = HeapInUse.load();
+  long long heap_start = HeapInUse;
+  FGFDMExec* fdm = 0;
+
+  try {
+    unsigned long long allocations = AllocationCount;
+    Clock::time_point start = Clock::now();
+    fdm = CreateFDM();
+    if (load(fdm)) {
+      result.load_ms = Elapsed(start) * 1000.0;
+      result.load_allocations = AllocationCount - allocations;
+      fdm->DisableOutput();
+      RunCase(fdm, result);
+    } else
+      result.status = "load failed";
+  } catch (const string& msg) {
+    result.status = msg;
+  } catch (const exception& e) {
+    result.status = e.what();
+  } catch (...) {
+    result.status = "unknown exception";
+  }
+
+  result.peak_heap_kb = (HeapPeak - heap_start) / 1024.0;
+
+  try {
+    delete fdm;
+  } catch (...) {}
+
+  progress << right << fixed << setprecision(1)
+           << setw(10) << result.load_ms << " ms"
+           << setw(12) << result.fps << " fps"
+           << setw(10) << setprecision(2) << result.allocations_per_frame
+           << " allocs/frame";
+  if (result.status != "ok") progress << "  " << result.status;
+  progress << endl;
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+struct AircraftLoader {
+  string aircraft;
+  SGPath ic;
+  bool operator()(FGFDMExec* fdm) const {
+    if (!fdm->LoadModel(aircraft)) return false;
+    return ic.isNull() || fdm->GetIC()->Load(ic, false);
+  }
+};
+
+struct ScriptLoader {
+  SGPath script;
+  bool operator()(FGFDMExec* fdm) const { return fdm->LoadScript(script); }
+};
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool Selected(const string& name)
+{
+  return Filter.empty() || name.find(Filter) != string::npos;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void BenchmarkAircraft(vector<Result>& results)
+{
+  SGPath aircraft_path = RootDir/"aircraft";
+  vector<string> dirs = ListDirectory(aircraft_path, true);
+
+  for (unsigned int i=0; i<dirs.size(); i++) {
+    string name = "aircraft/" + dirs[i];
+    if (dirs[i] == "blank" || !Selected(name)) continue;
+    if (!CheckXMLFile(aircraft_path/dirs[i]/(dirs[i] + ".xml"), "fdm_config"))
+      continue;
+
+    AircraftLoader loader;
+    loader.aircraft = dirs[i];
+    vector<string> files = ListDirectory(aircraft_path/dirs[i], false);
+    for (unsigned int j=0; j<files.size(); j++) {
+      SGPath file = aircraft_path/dirs[i]/files[j];
+      if (file.extension() == "xml" && CheckXMLFile(file, "initialize")) {
+        loader.ic = file;
+        break;
+      }
+    }
+
+    results.push_back(Benchmark(name, loader));
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void BenchmarkScripts(vector<Result>& results)
+{
+  SGPath script_path = RootDir/"scripts";
+  vector<string> files = ListDirectory(script_path, false);
+
+  for (unsigned int i=0; i<files.size(); i++) {
+    string name = "scripts/" + files[i];
+    SGPath file = script_path/files[i];
+    if (!Selected(name) || file.extension() != "xml") continue;
+    if (!CheckXMLFile(file, "runscript")) continue;
+
+    ScriptLoader loader;
+    loader.script = file;
+    results.push_back(Benchmark(name, loader));
+  }
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+JSON
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+string Quote(const string& s)
+{
+  string q("\"");
+  for (unsigned int i=0; i<s.size(); i++) {
+    unsigned char c = s[i];
+    if (c == '"' || c == '\\') { q += '\\'; q += c; }
+    else if (c == '\n') q += "\\n";
+    else if (c < 0x20) q += ' ';
+    else q += c;
+  }
+  return q + "\"";
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool WriteResults(const string& filename, const vector<Result>& results)
+{
+  ofstream out(filename.c_str());
+  if (!out.is_open()) return false;
+
+  out << setprecision(10);
+  out << "{" << endl
+      << "  \"version\": " << Quote(Version) << "," << endl
+      << "  \"measure-time\": " << MeasureTime << "," << endl
+      << "  \"warmup-time\": " << WarmupTime << "," << endl
+      << "  \"max-rss-kb\": " << GetMaxRSSKb() << "," << endl
+      << "  \"cases\": [" << endl;
+  for (unsigned int i=0; i<results.size(); i++) {
+    const Result& r = results[i];
+    out << "    {\"name\": " << Quote(r.name)
+        << ", \"status\": " << Quote(r.status)
+        << ", \"load-ms\": " << r.load_ms
+        << ", \"run-ic-ms\": " << r.run_ic_ms
+        << ", \"frames\": " << r.frames
+        << ", \"fps\": " << r.fps
+        << ", \"realtime-factor\": " << r.realtime_factor
+        << ", \"load-allocations\": " << r.load_allocations
+        << ", \"allocations-per-frame\": " << r.allocations_per_frame
+        << ", \"peak-heap-kb\": " << r.peak_heap_kb
+        << "}" << (i+1 < results.size() ? "," : "") << endl;
+  }
+  out << "  ]" << endl << "}" << endl;
+
+  return out.good();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// A reader for the subset of JSON written by WriteResults(): the objects of
+// the array "cases" are returned with their string and number members. The
+// members of the other objects are skipped.
+
+class BaselineReader
+{
+public:
+  typedef map<string, string> Case;
+
+  BaselineReader(const string& text) : s(text), pos(0) {}
+
+  bool Read(vector<Case>& cases)
+  {
+    try {
+      Case root;
+      Value(root, "", 0, cases);
+      return true;
+    } catch (const string& msg) {
+      cerr << "Baseline: " << msg << " at offset " << pos << endl;
+      return false;
+    }
+  }
+
+private:
+  const string& s;
+  size_t pos;
+
+  void Skip(void) { while (pos < s.size() && isspace((unsigned char)s[pos])) pos++; }
+
+  char Peek(void) { Skip(); if (pos >= s.size()) throw string("unexpected end"); return s[pos]; }
+
+  void Expect(char c) { if (Peek() != c) throw string("expected ") + c; pos++; }
+
+  string String(void)
+  {
+    Expect('"');
+    string str;
+    while (pos < s.size() && s[pos] != '"') {
+      if (s[pos] == '\\' && pos+1 < s.size()) {
+        pos++;
+        str += s[pos] == 'n' ? '\n' : s[pos];
+      } else
+        str += s[pos];
+      pos++;
+    }
+    Expect('"');
+    return str;
+  }
+
+  // Parses a value; the scalars are stored in 'parent' under 'key'. The
+  // objects found in an array named "cases" at depth 1 are added to 'cases'.
+  void Value(Case& parent, const string& key, int depth, vector<Case>& cases)
+  {
+    char c = Peek();
+    if (c == '{') {
+      pos++;
+      Case object;
+      if (Peek() != '}') {
+        do {
+          string member = String();
+          Expect(':');
+          Value(object, member, depth+1, cases);
+        } while (Peek() == ',' && ++pos);
+      }
+      Expect('}');
+      if (key == "cases" && depth == 2) cases.push_back(object);
+    } else if (c == '[') {
+      pos++;
+      if (Peek() != ']') {
+        do {
+          Value(parent, key, depth+1, cases);
+        } while (Peek() == ',' && ++pos);
+      }
+      Expect(']');
+    } else if (c == '"') {
+      parent[key] = String();
+    } else {
+      size_t start = pos;
+      while (pos < s.size() && (isalnum((unsigned char)s[pos]) || s[pos] == '-'
+                                || s[pos] == '+' || s[pos] == '.'))
+        pos++;
+      if (pos == start) throw string("unexpected character");
+      parent[key] = s.substr(start, pos - start);
+    }
+  }
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+BASELINE COMPARISON
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Prints a quantity that differs from the baseline by more than the
+// tolerance. 'higher_is_better' tells the direction of a regression and
+// 'floor' is the smallest absolute difference that is significant (the
+// measures of short times are noisy).
+bool Compare(const string& name, const string& quantity, double baseline,
+             double value, bool higher_is_better, double floor)
+{
+  double diff = value - baseline;
+  if (fabs(diff) <= floor) return false;
+  double ratio = baseline != 0.0 ? 100.0 * diff / fabs(baseline) : 100.0;
+  if (fabs(ratio) <= Tolerance) return false;
+
+  bool regression = higher_is_better ? diff < 0.0 : diff > 0.0;
+  progress << (regression ? "  REGRESSION  " : "  improvement ")
+           << setw(40) << left << name << setw(24) << quantity << right
+           << fixed << setprecision(2) << setw(12) << baseline << " -> "
+           << setw(12) << value << " (" << showpos << ratio << noshowpos
+           << "%)" << endl;
+  return regression;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns the number of regressions, or -1 if the baseline cannot be read.
+
+int CompareToBaseline(const string& filename, const vector<Result>& results)
+{
+  ifstream in(filename.c_str());
+  if (!in.is_open()) {
+    cerr << "Could not open the baseline " << filename << endl;
+    return -1;
+  }
+  stringstream text;
+  text << in.rdbuf();
+
+  string content = text.str();
+  vector<BaselineReader::Case> cases;
+  BaselineReader reader(content);
+  if (!reader.Read(cases)) return -1;
+
+  map<string, BaselineReader::Case> baseline;
+  for (unsigned int i=0; i<cases.size(); i++) baseline[cases[i]["name"]] = cases[i];
+
+  progress << endl << "Comparison to " << filename << " (tolerance "
+           << Tolerance << "%)" << endl;
+
+  int regressions = 0;
+  for (unsigned int i=0; i<results.size(); i++) {
+    const Result& r = results[i];
+    map<string, BaselineReader::Case>::iterator it = baseline.find(r.name);
+    if (it == baseline.end()) continue;
+    BaselineReader::Case& b = it->second;
+
+    if (b["status"] != r.status) {
+      bool regression = b["status"] == "ok";
+      progress << (regression ? "  REGRESSION  " : "  improvement ")
+               << setw(40) << left << r.name << right << " status "
+               << Quote(b["status"]) << " -> " << Quote(r.status) << endl;
+      if (regression) regressions++;
+      continue;
+    }
+    if (r.status != "ok") continue;
+
+    regressions += Compare(r.name, "load-ms", atof(b["load-ms"].c_str()),
+                           r.load_ms, false, 1.0);
+    regressions += Compare(r.name, "run-ic-ms", atof(b["run-ic-ms"].c_str()),
+                           r.run_ic_ms, false, 1.0);
+    if (r.frames > 0 && atof(b["frames"].c_str()) > 0.0)
+      regressions += Compare(r.name, "fps", atof(b["fps"].c_str()), r.fps,
+                             true, 0.0);
+    regressions += Compare(r.name, "load-allocations",
+                           atof(b["load-allocations"].c_str()),
+                           (double)r.load_allocations, false, 100.0);
+    regressions += Compare(r.name, "allocations-per-frame",
+                           atof(b["allocations-per-frame"].c_str()),
+                           r.allocations_per_frame, false, 0.5);
+    regressions += Compare(r.name, "peak-heap-kb",
+                           atof(b["peak-heap-kb"].c_str()), r.peak_heap_kb,
+                           false, 64.0);
+  }
+
+  progress << regressions << " regression(s)" << endl;
+  return regressions;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+OPTIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void PrintHelp(void)
+{
+  cout << endl << "  JSBSim benchmark" << endl << endl
+       << "  Usage: JSBSimBench [options]" << endl << endl
+       << "  options:" << endl
+       << "    --help  returns this message" << endl
+       << "    --root=<path>  specifies the JSBSim root directory (default: .)" << endl
+       << "    --output=<file>  specifies the JSON result file (default: benchmark.json)" << endl
+       << "    --baseline=<file>  compares the results to a previous result file" << endl
+       << "    --tolerance=<percent>  specifies the difference to the baseline reported as a regression (default: 10)" << endl
+       << "    --filter=<string>  only runs the cases whose name contains the string" << endl
+       << "    --time=<seconds>  specifies the wall clock duration of the steady state measure (default: 1)" << endl
+       << "    --warmup=<seconds>  specifies the simulated time run before the measure (default: 1)" << endl
+       << "    --noaircraft  does not run the aircraft" << endl
+       << "    --noscripts  does not run the scripts" << endl
+       << "    --verbose  keeps the console output of JSBSim" << endl << endl
+       << "  The program returns 1 if a case regressed compared to the baseline." << endl
+       << endl;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool options(int count, char **arg)
+{
+  for (int i=1; i<count; i++) {
+    string argument(arg[i]);
+    string keyword(argument);
+    string value;
+    string::size_type n = argument.find("=");
+
+    if (n != string::npos && n > 0) {
+      keyword = argument.substr(0, n);
+      value = argument.substr(n+1);
+    }
+
+    if (keyword == "--help") {
+      PrintHelp();
+      exit(0);
+    } else if (keyword == "--noaircraft") {
+      RunAircraft = false;
+    } else if (keyword == "--noscripts") {
+      RunScripts = false;
+    } else if (keyword == "--verbose") {
+      Verbose = true;
+    } else if (n == string::npos) {
+      cerr << "Unknown option or option '" << keyword
+           << "' requires a value, as in '" << keyword << "=something'" << endl;
+      return false;
+    } else if (keyword == "--root") {
+      RootDir = SGPath::fromLocal8Bit(value.c_str());
+    } else if (keyword == "--output") {
+      OutputName = value;
+    } else if (keyword == "--baseline") {
+      BaselineName = value;
+    } else if (keyword == "--tolerance") {
+      Tolerance = atof(value.c_str());
+    } else if (keyword == "--filter") {
+      Filter = value;
+    } else if (keyword == "--time") {
+      MeasureTime = atof(value.c_str());
+    } else if (keyword == "--warmup") {
+      WarmupTime = atof(value.c_str());
+    } else {
+      cerr << "Unknown option " << keyword << endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+MAIN
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+int main(int argc, char* argv[])
+{
+  if (!options(argc, argv)) {
+    PrintHelp();
+    return 2;
+  }
+
+  NullBuffer null_buffer;
+  streambuf* cout_buf = cout.rdbuf();
+  streambuf* cerr_buf = cerr.rdbuf();
+  if (!Verbose) {
+    FGJSBBase::debug_lvl = 0;
+    cout.rdbuf(&null_buffer);
+    cerr.rdbuf(&null_buffer);
+  }
+
+  FGFDMExec* fdm = CreateFDM();
+  Version = fdm->GetVersion();
+  delete fdm;
+
+  vector<Result> results;
+  if (RunAircraft) BenchmarkAircraft(results);
+  if (RunScripts) BenchmarkScripts(results);
+
+  cout.rdbuf(cout_buf);
+  cerr.rdbuf(cerr_buf);
+
+  if (!WriteResults(OutputName, results)) {
+    cerr << "Could not write " << OutputName << endl;
+    return 2;
+  }
+  progress << "Results written to " << OutputName << endl;
+
+  if (!BaselineName.empty()) {
+    int regressions = CompareToBaseline(BaselineName, results);
+    if (regressions < 0) return 2;
+    if (regressions > 0) return 1;
+  }
+
+  return 0;
+}